@@ -295,11 +295,16 @@ FileSymbols::buildIndex(IndexType Type, DuplicateHandling DuplicateHandle,
     if (Version)
       *Version = this->Version;
   }
+  size_t TotalSymbols = 0;
+  for (const auto &Slab : SymbolSlabs)
+    TotalSymbols += Slab->size();
+
   std::vector<const Symbol *> AllSymbols;
   std::vector<Symbol> SymsStorage;
   switch (DuplicateHandle) {
   case DuplicateHandling::Merge: {
     llvm::DenseMap<SymbolID, Symbol> Merged;
+    Merged.reserve(TotalSymbols);
     for (const auto &Slab : SymbolSlabs) {
       for (const auto &Sym : *Slab) {
         assert(Sym.References == 0 &&
@@ -318,6 +323,7 @@ FileSymbols::buildIndex(IndexType Type, DuplicateHandling DuplicateHandle,
         It->getSecond().References += Sym.second.size();
       }
     SymsStorage.reserve(Merged.size());
+    AllSymbols.reserve(Merged.size());
     for (auto &Sym : Merged) {
       SymsStorage.push_back(std::move(Sym.second));
       AllSymbols.push_back(&SymsStorage.back());
@@ -326,6 +332,8 @@ FileSymbols::buildIndex(IndexType Type, DuplicateHandling DuplicateHandle,
   }
   case DuplicateHandling::PickOne: {
     llvm::DenseSet<SymbolID> AddedSymbols;
+    AddedSymbols.reserve(TotalSymbols);
+    AllSymbols.reserve(TotalSymbols);
     for (const auto &Slab : SymbolSlabs)
       for (const auto &Sym : *Slab) {
         assert(Sym.References == 0 &&
@@ -341,6 +349,10 @@ FileSymbols::buildIndex(IndexType Type, DuplicateHandling DuplicateHandle,
   llvm::DenseMap<SymbolID, llvm::ArrayRef<Ref>> AllRefs;
   {
     llvm::DenseMap<SymbolID, llvm::SmallVector<Ref, 4>> MergedRefs;
+    size_t TotalRefSyms = 0;
+    for (const auto &RefSlab : RefSlabs)
+      TotalRefSyms += RefSlab->size();
+    MergedRefs.reserve(TotalRefSyms);
     size_t Count = 0;
     for (const auto &RefSlab : RefSlabs)
       for (const auto &Sym : *RefSlab) {
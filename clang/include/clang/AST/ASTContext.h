@@ -3330,9 +3330,16 @@ private:
   // into the datastructures which avoids this mess during deallocation but is
   // wasteful of memory, and here we require a lot of error prone book keeping
   // in order to track and run destructors while we're tearing things down.
-  using DeallocationFunctionsAndArguments =
-      llvm::SmallVector<std::pair<void (*)(void *), void *>, 16>;
+  // Objects are grouped by destruction callback: most registrations come from
+  // addDestruction over a handful of types, and running one callback over a
+  // contiguous list of objects keeps teardown's indirect calls predictable.
+  // Buckets run in first-registration order; the registered destructors only
+  // release memory owned by their object, so they do not depend on the
+  // relative destruction order of unrelated objects.
+  using DeallocationFunctionsAndArguments = llvm::SmallVector<
+      std::pair<void (*)(void *), llvm::SmallVector<void *, 4>>, 16>;
   mutable DeallocationFunctionsAndArguments Deallocations;
+  mutable llvm::DenseMap<void (*)(void *), unsigned> DeallocationBuckets;
 
   // FIXME: This currently contains the set of StoredDeclMaps used
   // by DeclContext objects.  This probably should not be in ASTContext,
@@ -36,6 +36,11 @@ class MacroArgs final
   /// concatenated together, with 'EOF' markers at the end of each argument.
   unsigned NumUnexpArgTokens;
 
+  /// NumAllocArgTokens - The number of unexpanded argument tokens this object
+  /// was allocated to hold. NumUnexpArgTokens may be smaller when the object
+  /// is reused from the free list for an invocation with fewer tokens.
+  unsigned NumAllocArgTokens;
+
   /// VarargsElided - True if this is a C99 style varargs macro invocation and
   /// there was no argument specified for the "..." argument.  If the argument
   /// was specified (even empty) or this isn't a C99 style varargs function, or
@@ -56,8 +61,9 @@ class MacroArgs final
   unsigned NumMacroArgs;
 
   MacroArgs(unsigned NumToks, bool varargsElided, unsigned MacroArgs)
-      : NumUnexpArgTokens(NumToks), VarargsElided(varargsElided),
-        ArgCache(nullptr), NumMacroArgs(MacroArgs) {}
+      : NumUnexpArgTokens(NumToks), NumAllocArgTokens(NumToks),
+        VarargsElided(varargsElided), ArgCache(nullptr),
+        NumMacroArgs(MacroArgs) {}
   ~MacroArgs() = default;
 
 public:
@@ -897,9 +897,11 @@ void ASTContext::cleanup() {
   ReleaseDeclContextMaps();
 
   // Call all of the deallocation functions on all of their targets.
-  for (auto &Pair : Deallocations)
-    (Pair.first)(Pair.second);
+  for (auto &Bucket : Deallocations)
+    for (void *Ptr : Bucket.second)
+      (Bucket.first)(Ptr);
   Deallocations.clear();
+  DeallocationBuckets.clear();
 
   // ASTRecordLayout objects in ASTRecordLayouts must always be destroyed
   // because they can contain DenseMaps.
@@ -938,7 +940,11 @@ void ASTContext::setTraversalScope(const std::vector<Decl *> &TopLevelDecls) {
 }
 
 void ASTContext::AddDeallocation(void (*Callback)(void *), void *Data) const {
-  Deallocations.push_back({Callback, Data});
+  auto [It, Inserted] =
+      DeallocationBuckets.try_emplace(Callback, Deallocations.size());
+  if (Inserted)
+    Deallocations.push_back({Callback, {}});
+  Deallocations[It->second].second.push_back(Data);
 }
 
 void
@@ -2543,6 +2543,13 @@ bool Lexer::SkipWhitespace(Token &Result, const char *CurPtr,
   return false;
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 /// We have just read the // characters from input.  Skip until we find the
 /// newline character that terminates the comment.  Then update BufferPtr and
 /// return.
@@ -2578,6 +2585,37 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
   char C;
   while (true) {
     C = *CurPtr;
+#ifdef __SSE2__
+    // Bulk-skip the comment body 16 bytes at a time, stopping at anything
+    // interesting: NUL (potential EOF or code completion point), '\n', '\r',
+    // or a byte with the high bit set (UTF-8). This mirrors the vectorized
+    // scan in SkipBlockComment. Unlike there, '\0' is part of the stop set,
+    // so no special casing of code-completion buffers is needed.
+    if (isASCII(C) && C != 0 && C != '\n' && C != '\r') {
+      const char *BulkStart = CurPtr;
+      const __m128i Newlines = _mm_set1_epi8('\n');
+      const __m128i CRs = _mm_set1_epi8('\r');
+      const __m128i Nulls = _mm_setzero_si128();
+      while (CurPtr + 16 < BufferEnd) {
+        __m128i Chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(CurPtr));
+        __m128i Interesting = _mm_or_si128(
+            _mm_cmpeq_epi8(Chunk, Newlines),
+            _mm_or_si128(_mm_cmpeq_epi8(Chunk, CRs),
+                         _mm_cmpeq_epi8(Chunk, Nulls)));
+        // The high-bit movemask of the raw chunk catches non-ASCII bytes.
+        int Mask = _mm_movemask_epi8(Interesting) | _mm_movemask_epi8(Chunk);
+        if (Mask != 0) {
+          CurPtr += llvm::countr_zero<unsigned>(Mask);
+          break;
+        }
+        CurPtr += 16;
+      }
+      if (CurPtr != BulkStart)
+        UnicodeDecodingAlreadyDiagnosed = false;
+      C = *CurPtr;
+    }
+#endif
     // Skip over characters in the fast loop.
     while (isASCII(C) && C != 0 &&   // Potentially EOF.
            C != '\n' && C != '\r') { // Newline or DOS-style newline.
@@ -2815,13 +2853,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
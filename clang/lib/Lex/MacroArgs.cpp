@@ -30,18 +30,21 @@ MacroArgs *MacroArgs::create(const MacroInfo *MI,
   unsigned ClosestMatch = ~0U;
 
   // See if we have an entry with a big enough argument list to reuse on the
-  // free list.  If so, reuse it.
+  // free list.  If so, reuse it.  Match on the allocated capacity, not the
+  // size of the last invocation that used the entry, so that reusing a block
+  // for a smaller invocation does not shrink what the free list thinks the
+  // block can hold.
   for (MacroArgs **Entry = &PP.MacroArgCache; *Entry;
        Entry = &(*Entry)->ArgCache) {
-    if ((*Entry)->NumUnexpArgTokens >= UnexpArgTokens.size() &&
-        (*Entry)->NumUnexpArgTokens < ClosestMatch) {
+    if ((*Entry)->NumAllocArgTokens >= UnexpArgTokens.size() &&
+        (*Entry)->NumAllocArgTokens < ClosestMatch) {
       ResultEnt = Entry;
 
       // If we have an exact match, use it.
-      if ((*Entry)->NumUnexpArgTokens == UnexpArgTokens.size())
+      if ((*Entry)->NumAllocArgTokens == UnexpArgTokens.size())
         break;
       // Otherwise, use the best fit.
-      ClosestMatch = (*Entry)->NumUnexpArgTokens;
+      ClosestMatch = (*Entry)->NumAllocArgTokens;
     }
   }
   MacroArgs *Result;
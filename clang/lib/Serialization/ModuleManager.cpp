@@ -198,14 +198,20 @@ ModuleManager::addModule(StringRef FileName, ModuleKind Type,
     return OutOfDate;
   } else {
     // Get a buffer of the file and close the file descriptor when done.
-    // The file is volatile because in a parallel build we expect multiple
-    // compiler processes to use the same module file rebuilding it if needed.
+    // Implicitly-built module files are volatile because in a parallel build
+    // we expect multiple compiler processes to use the same module file,
+    // rebuilding it if needed; reading it up front protects against the file
+    // changing underneath us. Explicit and prebuilt module files are ordinary
+    // immutable build inputs, so they can be mmapped: pages are demand-loaded,
+    // shared between concurrent compiler processes reading the same PCM, and
+    // evictable under memory pressure.
     //
     // RequiresNullTerminator is false because module files don't need it, and
     // this allows the file to still be mmapped.
-    auto Buf = FileMgr.getBufferForFile(NewModule->File,
-                                        /*IsVolatile=*/true,
-                                        /*RequiresNullTerminator=*/false);
+    auto Buf = FileMgr.getBufferForFile(
+        NewModule->File,
+        /*IsVolatile=*/NewModule->Kind == MK_ImplicitModule,
+        /*RequiresNullTerminator=*/false);
 
     if (!Buf) {
       ErrorStr = Buf.getError().message();
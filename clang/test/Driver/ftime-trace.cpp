@@ -62,6 +62,24 @@
 // UNUSED-NEXT: warning: argument unused during compilation: '-ftime-trace-granularity=1'
 // UNUSED-NOT:  warning:
 
+/// -ftime-trace-memory is forwarded to cc1 alongside -ftime-trace and records
+/// a "malloc delta" counter for each event.
+// RUN: %clang -### -c -ftime-trace -ftime-trace-granularity=0 -ftime-trace-memory d/a.cpp -o e/a.o 2>&1 \
+// RUN:   | FileCheck %s --check-prefix=MEMORY
+// MEMORY: -cc1{{.*}} "-ftime-trace=e/a.json" "-ftime-trace-granularity=0" "-ftime-trace-memory"
+
+// RUN: %clangxx -S -no-canonical-prefixes -ftime-trace=mem.json -ftime-trace-granularity=0 -ftime-trace-memory -o out %s
+// RUN: cat mem.json \
+// RUN:   | %python -c 'import json, sys; json.dump(json.loads(sys.stdin.read()), sys.stdout, sort_keys=True, indent=2)' \
+// RUN:   | FileCheck %s --check-prefix=MEMTRACE
+// MEMTRACE: "malloc delta":
+
+/// Without -ftime-trace the flag has nothing to annotate and is left unused.
+// RUN: %clang -### -c -ftime-trace-memory d/a.cpp -o e/a.o 2>&1 \
+// RUN:   | FileCheck %s --check-prefix=MEMUNUSED
+// MEMUNUSED:     warning: argument unused during compilation: '-ftime-trace-memory'
+// MEMUNUSED-NOT: warning:
+
 template <typename T>
 struct Struct {
   T Num;
@@ -193,7 +193,6 @@ class LargeChunkHeader {
 };
 
 static void FillChunk(AsanChunk *m) {
-  // FIXME: Use ReleaseMemoryPagesToOS.
   Flags &fl = *flags();
 
   if (fl.max_free_fill_size > 0) {
@@ -214,10 +213,22 @@ struct QuarantineCallback {
   }
 
   void PreQuarantine(AsanChunk *m) const {
+    Flags &fl = *flags();
     FillChunk(m);
     // Poison the region.
     PoisonShadow(m->Beg(), RoundUpTo(m->UsedSize(), ASAN_SHADOW_GRANULARITY),
                  kAsanHeapFreeMagic);
+    if (fl.release_quarantined_pages && m->UsedSize() >= kChunkHeader2Size) {
+      // The chunk is dead until it leaves the quarantine, so pages wholly
+      // inside the user region can go back to the OS. Keep Header2 (it holds
+      // the free context id) and the free-fill pattern, if any; the shadow
+      // keeps the heap-freed poisoning either way.
+      uptr keep = kChunkHeader2Size;
+      if (fl.max_free_fill_size > 0)
+        keep += Min(m->UsedSize() - kChunkHeader2Size,
+                    (uptr)fl.max_free_fill_size);
+      ReleaseMemoryPagesToOS(m->Beg() + keep, m->Beg() + m->UsedSize());
+    }
   }
 
   void Recycle(AsanChunk *m) const {
@@ -0,0 +1,55 @@
+// Tests ASAN_OPTIONS=release_quarantined_pages=1
+
+// RUN: %clangxx_asan -O0 %s -o %t
+// RUN: %env_asan_opts=release_quarantined_pages=1:quarantine_size_mb=256 %run %t rss 2>&1 | FileCheck %s --check-prefix=RSS
+// RUN: %env_asan_opts=release_quarantined_pages=1:quarantine_size_mb=256 not %run %t uaf 2>&1 | FileCheck %s --check-prefix=UAF
+
+// REQUIRES: stable-runtime
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+const size_t kChunkSize = 100 << 10;
+const size_t kNumChunks = 1000;
+
+static size_t GetRSS() {
+  size_t size = 0, rss = 0;
+  FILE *f = fopen("/proc/self/statm", "r");
+  if (!f || fscanf(f, "%zu %zu", &size, &rss) != 2)
+    return 0;
+  fclose(f);
+  return rss * sysconf(_SC_PAGESIZE);
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && !strcmp("uaf", argv[1])) {
+    // The freed chunk keeps its header while quarantined, so the report must
+    // still name the freeing stack even though the user pages were released.
+    char *p = (char *)malloc(kChunkSize);
+    free(p);
+    return p[kChunkSize / 2];
+    // UAF: AddressSanitizer: heap-use-after-free
+    // UAF: freed by thread T0 here:
+    // UAF: previously allocated by thread T0 here:
+  }
+
+  // Fill the quarantine with resident pages, then check that freeing
+  // returned most of them to the OS.
+  static char *chunks[kNumChunks];
+  for (size_t i = 0; i < kNumChunks; i++) {
+    chunks[i] = (char *)malloc(kChunkSize);
+    memset(chunks[i], 0xab, kChunkSize);
+  }
+  size_t rss_before = GetRSS();
+  for (size_t i = 0; i < kNumChunks; i++)
+    free(chunks[i]);
+  size_t rss_after = GetRSS();
+  fprintf(stderr, "rss_before: %zu rss_after: %zu\n", rss_before, rss_after);
+  fprintf(stderr, "%s\n", rss_before > rss_after + kNumChunks * kChunkSize / 2
+                              ? "RSS-DROPPED"
+                              : "RSS-KEPT");
+  // RSS: RSS-DROPPED
+  return 0;
+}
@@ -14,12 +14,18 @@
 #ifndef LLVM_LIBC_SRC_STRING_STRING_UTILS_H
 #define LLVM_LIBC_SRC_STRING_STRING_UTILS_H
 
+#include "src/__support/CPP/bit.h" // countr_zero
 #include "src/__support/CPP/bitset.h"
 #include "src/__support/macros/optimization.h" // LIBC_UNLIKELY
+#include "src/__support/macros/properties/architectures.h"
 #include "src/string/memory_utils/inline_bzero.h"
 #include "src/string/memory_utils/inline_memcpy.h"
 #include <stddef.h> // For size_t
 
+#if defined(LIBC_TARGET_ARCH_IS_X86_64) && defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace LIBC_NAMESPACE {
 namespace internal {
 
@@ -78,6 +84,32 @@ LIBC_INLINE size_t string_length_wide_read(const char *src) {
   return char_ptr - src;
 }
 
+#if defined(LIBC_TARGET_ARCH_IS_X86_64) && defined(__SSE2__)
+// Same scheme as string_length_wide_read but with a 16 byte vector as the
+// block. Like the wide read above this may read up to sizeof(__m128i) - 1
+// bytes past the null terminator, but since every read is aligned it can
+// never cross into an unmapped page.
+LIBC_INLINE size_t string_length_vector_read(const char *src) {
+  const char *char_ptr = src;
+  // Step 1: read 1 byte at a time to align to block size
+  for (; reinterpret_cast<uintptr_t>(char_ptr) % sizeof(__m128i) != 0;
+       ++char_ptr) {
+    if (*char_ptr == '\0')
+      return char_ptr - src;
+  }
+  // Step 2: read blocks, stopping at the one containing the terminator. The
+  // comparison produces a byte mask, so the zero's index within the block is
+  // the number of trailing zero bits in the mask.
+  for (const __m128i *block_ptr = reinterpret_cast<const __m128i *>(char_ptr);
+       ; ++block_ptr) {
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(*block_ptr, _mm_setzero_si128()));
+    if (mask != 0)
+      return reinterpret_cast<const char *>(block_ptr) +
+             cpp::countr_zero(static_cast<unsigned int>(mask)) - src;
+  }
+}
+#endif
+
 LIBC_INLINE size_t string_length_byte_read(const char *src) {
   size_t length;
   for (length = 0; *src; ++src, ++length)
@@ -89,11 +121,18 @@ LIBC_INLINE size_t string_length_byte_read(const char *src) {
 // of a null terminator.
 LIBC_INLINE size_t string_length(const char *src) {
 #ifdef LIBC_COPT_STRING_UNSAFE_WIDE_READ
+#if defined(LIBC_TARGET_ARCH_IS_X86_64) && defined(__SSE2__)
+  // A 16 byte vector compare examines four times as many bytes per iteration
+  // as the unsigned int wide read and locates the terminator with a single
+  // mask scan, so prefer it where SSE2 is part of the baseline.
+  return string_length_vector_read(src);
+#else
   // Unsigned int is the default size for most processors, and on x86-64 it
   // performs better than larger sizes when the src pointer can't be assumed to
   // be aligned to a word boundary, so it's the size we use for reading the
   // string a block at a time.
   return string_length_wide_read<unsigned int>(src);
+#endif
 #else
   return string_length_byte_read(src);
 #endif
@@ -21,6 +21,7 @@
 #include <__fwd/bit_reference.h>
 #include <__iterator/segmented_iterator.h>
 #include <__string/constexpr_c_functions.h>
+#include <__type_traits/is_constant_evaluated.h>
 #include <__type_traits/is_integral.h>
 #include <__type_traits/is_same.h>
 #include <__type_traits/is_signed.h>
@@ -79,6 +80,59 @@ __find_impl(_Tp* __first, _Tp* __last, const _Up& __value, _Proj&) {
 }
 #endif // _LIBCPP_HAS_NO_WIDE_CHARACTERS
 
+#ifdef _LIBCPP_LITTLE_ENDIAN
+// 16- and 32-bit trivially equality comparable types with no C library search
+// function: scan a word at a time. XOR with the repeated value makes matching
+// lanes zero, and the zero-lane bit trick flags them. Inter-lane borrows can
+// only set flags in lanes above a genuine match, so on little-endian the
+// lowest flagged lane is the first match; on big-endian that lane may not be,
+// which is why this path is little-endian only.
+template <class _Tp,
+          class _Up,
+          class _Proj,
+          __enable_if_t<__is_identity<_Proj>::value && __libcpp_is_trivially_equality_comparable<_Tp, _Up>::value &&
+                            (sizeof(_Tp) == 2 || sizeof(_Tp) == 4)
+#  ifndef _LIBCPP_HAS_NO_WIDE_CHARACTERS
+                            && !(sizeof(_Tp) == sizeof(wchar_t) && _LIBCPP_ALIGNOF(_Tp) >= _LIBCPP_ALIGNOF(wchar_t))
+#  endif
+                        ,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX14 _Tp*
+__find_impl(_Tp* __first, _Tp* __last, const _Up& __value, _Proj&) {
+  const _Tp __v = static_cast<_Tp>(__value);
+  if (__libcpp_is_constant_evaluated()) {
+    for (; __first != __last; ++__first)
+      if (*__first == __v)
+        return __first;
+    return __last;
+  }
+
+  using __word_type          = unsigned long long;
+  const unsigned __lane_bits = sizeof(_Tp) * numeric_limits<unsigned char>::digits;
+  const int __lanes          = sizeof(__word_type) / sizeof(_Tp);
+  // 1 in the low bit of every lane, and the high bit of every lane.
+  const __word_type __ones  = numeric_limits<__word_type>::max() / ((__word_type(1) << __lane_bits) - 1);
+  const __word_type __highs = __ones << (__lane_bits - 1);
+
+  __word_type __lane = 0;
+  __builtin_memcpy(&__lane, &__v, sizeof(_Tp));
+  const __word_type __pattern = __lane * __ones;
+
+  for (; __last - __first >= __lanes; __first += __lanes) {
+    __word_type __word;
+    __builtin_memcpy(&__word, __first, sizeof(__word_type));
+    __word ^= __pattern;
+    const __word_type __zeros = (__word - __ones) & ~__word & __highs;
+    if (__zeros != 0)
+      return __first + (static_cast<unsigned>(std::__libcpp_ctz(__zeros)) / __lane_bits);
+  }
+  for (; __first != __last; ++__first)
+    if (*__first == __v)
+      return __first;
+  return __last;
+}
+#endif // _LIBCPP_LITTLE_ENDIAN
+
 // TODO: This should also be possible to get right with different signedness
 // cast integral types to allow vectorization
 template <class _Tp,
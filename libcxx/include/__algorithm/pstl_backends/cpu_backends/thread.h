@@ -9,13 +9,28 @@
 #ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_THREAD_H
 #define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_THREAD_H
 
+#include <__algorithm/max.h>
+#include <__algorithm/min.h>
 #include <__assert>
+#include <__atomic/atomic.h>
+#include <__atomic/memory_order.h>
 #include <__config>
+#include <__iterator/move_iterator.h>
+#include <__memory/allocator.h>
+#include <__memory/construct_at.h>
+#include <__memory/unique_ptr.h>
+#include <__numeric/reduce.h>
 #include <__utility/empty.h>
 #include <__utility/move.h>
 #include <cstddef>
+#include <new>
 #include <optional>
 
+#ifndef _LIBCPP_HAS_NO_THREADS
+#  include <__system_error/system_error.h>
+#  include <__thread/thread.h>
+#endif
+
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
 #endif
@@ -25,14 +40,157 @@ _LIBCPP_PUSH_MACROS
 
 #if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER >= 17
 
-// This backend implementation is for testing purposes only and not meant for production use. This will be replaced
-// by a proper implementation once the PSTL implementation is somewhat stable.
-
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 namespace __par_backend {
 inline namespace __thread_cpu_backend {
 
+#  ifndef _LIBCPP_HAS_NO_THREADS
+
+struct __chunk_partitions {
+  ptrdiff_t __chunk_count_; // includes the first chunk
+  ptrdiff_t __chunk_size_;
+  ptrdiff_t __first_chunk_size_;
+};
+
+// Don't bother splitting off chunks smaller than this; below it the scheduling
+// overhead dominates whatever the chunk computes.
+inline constexpr ptrdiff_t __min_chunk_size = 1024;
+
+inline _LIBCPP_HIDE_FROM_ABI __chunk_partitions __partition_chunks(ptrdiff_t __size) noexcept {
+  __chunk_partitions __partitions;
+  ptrdiff_t __max_chunks = std::max<ptrdiff_t>(1, __size / __min_chunk_size);
+  ptrdiff_t __threads    = std::max<ptrdiff_t>(1, thread::hardware_concurrency());
+  // Oversubscribe chunks relative to threads so that workers pulling chunks
+  // off the shared counter stay load balanced even when the per-element cost
+  // varies across the range.
+  __partitions.__chunk_count_      = std::min<ptrdiff_t>(__max_chunks, 4 * __threads);
+  __partitions.__chunk_size_       = __size / __partitions.__chunk_count_;
+  __partitions.__first_chunk_size_ = __partitions.__chunk_size_ + __size % __partitions.__chunk_count_;
+  return __partitions;
+}
+
+// Runs __func(__chunk) for every chunk index in [0, __chunk_count). The calling
+// thread and a batch of freshly spawned helpers claim chunks through a shared
+// atomic counter, so a worker that finishes early pulls the next unclaimed
+// chunk instead of idling; this gives the load balancing of a stealing
+// scheduler without a persistent task queue, which a header-only backend cannot
+// own. If spawning helpers fails the calling thread processes the chunks the
+// missing helpers would have taken. Exceptions escaping __func terminate, as
+// they do in the other parallel backends.
+template <class _Func>
+_LIBCPP_HIDE_FROM_ABI void __dispatch_chunks(ptrdiff_t __chunk_count, _Func __func) noexcept {
+  atomic<ptrdiff_t> __next_chunk(0);
+  auto __work = [&]() noexcept {
+    for (ptrdiff_t __chunk = __next_chunk.fetch_add(1, memory_order_relaxed); __chunk < __chunk_count;
+         __chunk = __next_chunk.fetch_add(1, memory_order_relaxed))
+      __func(__chunk);
+  };
+
+  ptrdiff_t __helper_count =
+      std::min(__chunk_count, std::max<ptrdiff_t>(1, thread::hardware_concurrency())) - 1;
+  thread* __helpers    = __helper_count > 0 ? new (nothrow) thread[__helper_count] : nullptr;
+  ptrdiff_t __spawned  = 0;
+  if (__helpers != nullptr) {
+#  ifndef _LIBCPP_HAS_NO_EXCEPTIONS
+    try {
+#  endif
+      for (; __spawned != __helper_count; ++__spawned)
+        __helpers[__spawned] = thread(__work);
+#  ifndef _LIBCPP_HAS_NO_EXCEPTIONS
+    } catch (const system_error&) {
+      // Thread resources are exhausted; run with the helpers that did start.
+    }
+#  endif
+  }
+
+  __work();
+
+  for (ptrdiff_t __i = 0; __i != __spawned; ++__i)
+    __helpers[__i].join();
+  delete[] __helpers;
+}
+
+template <class _RandomAccessIterator, class _Fp>
+_LIBCPP_HIDE_FROM_ABI optional<__empty>
+__parallel_for(_RandomAccessIterator __first, _RandomAccessIterator __last, _Fp __f) {
+  auto __partitions = __thread_cpu_backend::__partition_chunks(__last - __first);
+  if (__partitions.__chunk_count_ < 2) {
+    __f(__first, __last);
+    return __empty{};
+  }
+
+  __thread_cpu_backend::__dispatch_chunks(__partitions.__chunk_count_, [&](ptrdiff_t __chunk) {
+    auto __this_chunk_size = __chunk == 0 ? __partitions.__first_chunk_size_ : __partitions.__chunk_size_;
+    auto __index =
+        __chunk == 0
+            ? 0
+            : (__chunk * __partitions.__chunk_size_) + (__partitions.__first_chunk_size_ - __partitions.__chunk_size_);
+    __f(__first + __index, __first + __index + __this_chunk_size);
+  });
+  return __empty{};
+}
+
+template <class _Index, class _UnaryOp, class _Tp, class _BinaryOp, class _Reduce>
+_LIBCPP_HIDE_FROM_ABI optional<_Tp>
+__parallel_transform_reduce(_Index __first, _Index __last, _UnaryOp __transform, _Tp __init, _BinaryOp __combiner,
+                            _Reduce __reduce) {
+  auto __partitions = __thread_cpu_backend::__partition_chunks(__last - __first);
+  if (__partitions.__chunk_count_ < 2)
+    return __reduce(std::move(__first), std::move(__last), std::move(__init));
+
+  auto __destroy = [__count = __partitions.__chunk_count_](_Tp* __ptr) {
+    std::destroy_n(__ptr, __count);
+    std::allocator<_Tp>().deallocate(__ptr, __count);
+  };
+
+  // TODO: use __uninitialized_buffer
+  // TODO: allocate one element per worker instead of one element per chunk
+  unique_ptr<_Tp[], decltype(__destroy)> __values(
+      [&]() -> _Tp* {
+#  ifndef _LIBCPP_HAS_NO_EXCEPTIONS
+        try {
+#  endif
+          return std::allocator<_Tp>().allocate(__partitions.__chunk_count_);
+#  ifndef _LIBCPP_HAS_NO_EXCEPTIONS
+        } catch (const std::bad_alloc&) {
+          return nullptr;
+        }
+#  endif
+      }(),
+      __destroy);
+
+  if (!__values)
+    return nullopt;
+
+  // Every chunk constructs exactly one partial value, so all
+  // __chunk_count_ values are live once __dispatch_chunks returns.
+  __thread_cpu_backend::__dispatch_chunks(__partitions.__chunk_count_, [&](ptrdiff_t __chunk) {
+    auto __this_chunk_size = __chunk == 0 ? __partitions.__first_chunk_size_ : __partitions.__chunk_size_;
+    auto __index =
+        __chunk == 0
+            ? 0
+            : (__chunk * __partitions.__chunk_size_) + (__partitions.__first_chunk_size_ - __partitions.__chunk_size_);
+    if (__this_chunk_size != 1) {
+      std::__construct_at(
+          __values.get() + __chunk,
+          __reduce(__first + __index + 2,
+                   __first + __index + __this_chunk_size,
+                   __combiner(__transform(__first + __index), __transform(__first + __index + 1))));
+    } else {
+      std::__construct_at(__values.get() + __chunk, __transform(__first + __index));
+    }
+  });
+
+  return std::reduce(
+      std::make_move_iterator(__values.get()),
+      std::make_move_iterator(__values.get() + __partitions.__chunk_count_),
+      std::move(__init),
+      __combiner);
+}
+
+#  else // _LIBCPP_HAS_NO_THREADS
+
 template <class _RandomAccessIterator, class _Fp>
 _LIBCPP_HIDE_FROM_ABI optional<__empty>
 __parallel_for(_RandomAccessIterator __first, _RandomAccessIterator __last, _Fp __f) {
@@ -46,6 +204,10 @@ __parallel_transform_reduce(_Index __first, _Index __last, _UnaryOp, _Tp __init,
   return __reduce(std::move(__first), std::move(__last), std::move(__init));
 }
 
+#  endif // _LIBCPP_HAS_NO_THREADS
+
+// TODO: parallelize these by routing the leaf chunks through __dispatch_chunks
+// the way the libdispatch backend does.
 template <class _RandomAccessIterator, class _Compare, class _LeafSort>
 _LIBCPP_HIDE_FROM_ABI optional<__empty> __parallel_stable_sort(
     _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp, _LeafSort __leaf_sort) {
@@ -512,8 +512,17 @@ template <class ELFT> void ICF<ELFT>::run() {
 
   // From now on, sections in Sections vector are ordered so that sections
   // in the same equivalence class are consecutive in the vector.
-  llvm::stable_sort(sections, [](const InputSection *a, const InputSection *b) {
-    return a->eqClass[0] < b->eqClass[0];
+  //
+  // The sort runs in parallel. Determinism (in particular the choice of the
+  // representative section, which is the first of its class) is preserved by
+  // tie-breaking on the input order, stashed in eqClass[1]; that slot is dead
+  // here and gets overwritten by the first segregate() pass anyway.
+  for (size_t i = 0, e = sections.size(); i != e; ++i)
+    sections[i]->eqClass[1] = i;
+  parallelSort(sections, [](const InputSection *a, const InputSection *b) {
+    if (a->eqClass[0] != b->eqClass[0])
+      return a->eqClass[0] < b->eqClass[0];
+    return a->eqClass[1] < b->eqClass[1];
   });
 
   // Compare static contents and assign unique equivalence class IDs for each
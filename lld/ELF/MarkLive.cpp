@@ -31,6 +31,7 @@
 #include "lld/Common/Strings.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Object/ELF.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/TimeProfiler.h"
 #include <vector>
 
@@ -213,9 +214,19 @@ template <class ELFT> void MarkLive<ELFT>::run() {
 
   // Preserve externally-visible symbols if the symbols defined by this
   // file can interpose other ELF file's symbols at runtime.
-  for (Symbol *sym : symtab.getSymbols())
-    if (sym->includeInDynsym() && sym->partition == partition)
-      markSymbol(sym);
+  //
+  // includeInDynsym() is relatively expensive (binding and versioning checks
+  // per symbol) and has no side effects, so compute it in parallel and then
+  // enqueue the roots in symbol table order.
+  ArrayRef<Symbol *> syms = symtab.getSymbols();
+  SmallVector<uint8_t, 0> isRoot(syms.size());
+  parallelFor(0, syms.size(), [&](size_t i) {
+    isRoot[i] =
+        syms[i]->includeInDynsym() && syms[i]->partition == partition;
+  });
+  for (size_t i = 0, e = syms.size(); i != e; ++i)
+    if (isRoot[i])
+      markSymbol(syms[i]);
 
   // If this isn't the main partition, that's all that we need to preserve.
   if (partition != 1) {
@@ -365,10 +376,13 @@ template <class ELFT> void elf::markLive() {
     return;
   }
 
-  for (InputSectionBase *sec : ctx.inputSections)
-    sec->markDead();
+  parallelForEach(ctx.inputSections,
+                  [](InputSectionBase *sec) { sec->markDead(); });
 
-  // Follow the graph to mark all live sections.
+  // Follow the graph to mark all live sections. The walk itself stays
+  // single-threaded: it updates section partitions and per-piece liveness
+  // bitfields that cannot be written concurrently without widening them to
+  // atomics.
   for (unsigned curPart = 1; curPart <= partitions.size(); ++curPart)
     MarkLive<ELFT>(curPart).run();
 
@@ -346,46 +346,34 @@ template <class ELFT> void OutputSection::maybeCompress() {
   }
 
 #if LLVM_ENABLE_ZSTD
-  // Use ZSTD's streaming compression API which permits parallel workers working
-  // on the stream. See http://facebook.github.io/zstd/zstd_manual.html
-  // "Streaming compression - HowTo".
+  // Compress shards independently, one zstd frame per shard. Concatenated
+  // frames are a valid zstd stream and every decompressor we care about
+  // (including llvm::compression::zstd) handles multi-frame input, so this
+  // parallelizes both sides: shards are compressed here with parallelFor
+  // regardless of whether libzstd was built with ZSTD_MULTITHREAD, and
+  // writeTo copies them into place in parallel as well.
   if (config->compressDebugSections == DebugCompressionType::Zstd) {
-    // Allocate a buffer of half of the input size, and grow it by 1.5x if
-    // insufficient.
-    compressed.shards = std::make_unique<SmallVector<uint8_t, 0>[]>(1);
-    SmallVector<uint8_t, 0> &out = compressed.shards[0];
-    out.resize_for_overwrite(std::max<size_t>(size / 2, 32));
-    size_t pos = 0;
-
-    ZSTD_CCtx *cctx = ZSTD_createCCtx();
-    // Ignore error if zstd was not built with ZSTD_MULTITHREAD.
-    (void)ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers,
-                                 parallel::strategy.compute_thread_count());
-    ZSTD_outBuffer zob = {out.data(), out.size(), 0};
-    ZSTD_EndDirective directive = ZSTD_e_continue;
-    const size_t blockSize = ZSTD_CStreamInSize();
-    do {
-      const size_t n = std::min(static_cast<size_t>(size - pos), blockSize);
-      if (n == size - pos)
-        directive = ZSTD_e_end;
-      ZSTD_inBuffer zib = {buf.get() + pos, n, 0};
-      size_t bytesRemaining = 0;
-      while (zib.pos != zib.size ||
-             (directive == ZSTD_e_end && bytesRemaining != 0)) {
-        if (zob.pos == zob.size) {
-          out.resize_for_overwrite(out.size() * 3 / 2);
-          zob.dst = out.data();
-          zob.size = out.size();
-        }
-        bytesRemaining = ZSTD_compressStream2(cctx, &zob, &zib, directive);
-        assert(!ZSTD_isError(bytesRemaining));
-      }
-      pos += n;
-    } while (directive != ZSTD_e_end);
-    out.resize(zob.pos);
-    ZSTD_freeCCtx(cctx);
+    // Split input into 1-MiB shards.
+    constexpr size_t shardSize = 1 << 20;
+    auto shardsIn = split(ArrayRef<uint8_t>(buf.get(), size), shardSize);
+    const size_t numShards = shardsIn.size();
+
+    auto shardsOut = std::make_unique<SmallVector<uint8_t, 0>[]>(numShards);
+    parallelFor(0, numShards, [&](size_t i) {
+      SmallVector<uint8_t, 0> &out = shardsOut[i];
+      out.resize_for_overwrite(ZSTD_compressBound(shardsIn[i].size()));
+      size_t n = ZSTD_compress(out.data(), out.size(), shardsIn[i].data(),
+                               shardsIn[i].size(), ZSTD_CLEVEL_DEFAULT);
+      assert(!ZSTD_isError(n));
+      out.truncate(n);
+    });
 
-    size = sizeof(Elf_Chdr) + out.size();
+    size = sizeof(Elf_Chdr);
+    for (size_t i = 0; i != numShards; ++i)
+      size += shardsOut[i].size();
+
+    compressed.shards = std::move(shardsOut);
+    compressed.numShards = numShards;
     flags |= SHF_COMPRESSED;
     return;
   }
@@ -460,7 +448,16 @@ void OutputSection::writeTo(uint8_t *buf, parallel::TaskGroup &tg) {
     buf += sizeof(*chdr);
     if (config->compressDebugSections == DebugCompressionType::Zstd) {
       chdr->ch_type = ELFCOMPRESS_ZSTD;
-      memcpy(buf, compressed.shards[0].data(), compressed.shards[0].size());
+      // The concatenated zstd frames have no stream-level header or trailer;
+      // copy the shards into place back to back.
+      auto offsets = std::make_unique<size_t[]>(compressed.numShards);
+      offsets[0] = 0;
+      for (size_t i = 1; i != compressed.numShards; ++i)
+        offsets[i] = offsets[i - 1] + compressed.shards[i - 1].size();
+      parallelFor(0, compressed.numShards, [&](size_t i) {
+        memcpy(buf + offsets[i], compressed.shards[i].data(),
+               compressed.shards[i].size());
+      });
       return;
     }
     chdr->ch_type = ELFCOMPRESS_ZLIB;
@@ -1573,16 +1573,27 @@ template <class ELFT> void elf::scanRelocations() {
   // for parallelism.
   bool serial = !config->zCombreloc || config->emachine == EM_MIPS ||
                 config->emachine == EM_PPC64;
+
+  // Collect the sections to scan up front and spawn fixed-size batches rather
+  // than one task per input file. With LTO most relocations live in a handful
+  // of large object files and per-file granularity would leave most threads
+  // idle. The scan order within a batch follows the input order, so the
+  // serial mode (where spawn executes eagerly) behaves exactly as before.
+  SmallVector<InputSectionBase *, 0> sections;
+  for (ELFFileBase *f : ctx.objectFiles)
+    for (InputSectionBase *s : f->getSections())
+      if (s && s->kind() == SectionBase::Regular && s->isLive() &&
+          (s->flags & SHF_ALLOC) &&
+          !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
+        sections.push_back(s);
+
   parallel::TaskGroup tg;
-  for (ELFFileBase *f : ctx.objectFiles) {
-    auto fn = [f]() {
+  constexpr size_t batchSize = 256;
+  for (size_t i = 0, e = sections.size(); i < e; i += batchSize) {
+    auto fn = [&sections, i, e]() {
       RelocationScanner scanner;
-      for (InputSectionBase *s : f->getSections()) {
-        if (s && s->kind() == SectionBase::Regular && s->isLive() &&
-            (s->flags & SHF_ALLOC) &&
-            !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
-          scanner.template scanSection<ELFT>(*s);
-      }
+      for (size_t j = i, je = std::min(e, i + batchSize); j != je; ++j)
+        scanner.template scanSection<ELFT>(*sections[j]);
     };
     tg.spawn(fn, serial);
   }
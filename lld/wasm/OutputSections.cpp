@@ -79,9 +79,11 @@ void CodeSection::writeTo(uint8_t *buf) {
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+  // Write code section bodies. Each function body writes to a disjoint
+  // [outSecOff, outSecOff + size) range computed in finalizeContents, so the
+  // copies and relocations can be applied in parallel.
+  parallelForEach(functions,
+                  [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
 }
 
 uint32_t CodeSection::getNumRelocations() const {
@@ -183,9 +185,12 @@ void DataSection::writeTo(uint8_t *buf) {
     uint8_t *segStart = buf + segment->sectionOffset;
     memcpy(segStart, segment->header.data(), segment->header.size());
 
-    // Write segment data payload
-    for (const InputChunk *chunk : segment->inputSegments)
-      chunk->writeTo(buf);
+    // Write segment data payload. Chunk ranges within a segment are disjoint,
+    // so the copies and relocations can be applied in parallel. Active
+    // segments are normally combined into a single output segment, so this is
+    // where the bulk of the data section is written.
+    parallelForEach(segment->inputSegments,
+                    [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
   }
 }
 
@@ -269,9 +274,10 @@ void CustomSection::writeTo(uint8_t *buf) {
   memcpy(buf, nameData.data(), nameData.size());
   buf += nameData.size();
 
-  // Write custom sections payload
-  for (const InputChunk *section : inputSections)
-    section->writeTo(buf);
+  // Write custom sections payload. As in the code section, every chunk has a
+  // precomputed disjoint output range.
+  parallelForEach(inputSections,
+                  [buf](const InputChunk *section) { section->writeTo(buf); });
 }
 
 uint32_t CustomSection::getNumRelocations() const {
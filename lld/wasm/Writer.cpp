@@ -219,10 +219,14 @@ void Writer::writeHeader() {
 
 void Writer::writeSections() {
   uint8_t *buf = buffer->getBufferStart();
-  parallelForEach(outputSections, [buf](OutputSection *s) {
+  // Write sections in order. Nested calls to parallelForEach execute
+  // sequentially, so parallelize over the chunks within each section (where
+  // the bulk of the work is: the single code section contains every function
+  // body) rather than over the sections themselves.
+  for (OutputSection *s : outputSections) {
     assert(s->isNeeded());
     s->writeTo(buf);
-  });
+  }
 }
 
 // Computes a hash value of Data using a given hash function.
@@ -30,12 +30,33 @@
 #include <type_traits>
 #include <utility>
 
+#ifdef LLVM_ENABLE_SMALLVECTOR_STATS
+#include "llvm/Support/TypeName.h"
+#endif
+
 namespace llvm {
 
 template <typename T> class ArrayRef;
 
+class StringRef;
+
 template <typename IteratorT> class iterator_range;
 
+namespace detail {
+/// Record the end of one SmallVector lifetime for the usage-statistics mode
+/// enabled by defining LLVM_ENABLE_SMALLVECTOR_STATS (in both the library and
+/// its users). \p FinalCapacity is the capacity at destruction; since
+/// SmallVector never shrinks its allocation this is the high-water mark for
+/// the object. \p Spilled is true if the vector outgrew its inline storage.
+/// The collector aggregates per instantiation and prints a report ranked by
+/// total heap bytes to stderr on llvm_shutdown(). Defined unconditionally in
+/// lib/Support/SmallVector.cpp so a stats-enabled client links against a
+/// library built without the macro.
+void recordSmallVectorLifetime(StringRef TypeName, size_t EltSize,
+                               size_t InlineElts, size_t FinalCapacity,
+                               bool Spilled);
+} // end namespace detail
+
 template <class Iterator>
 using EnableIfConvertibleToInputIterator = std::enable_if_t<std::is_convertible<
     typename std::iterator_traits<Iterator>::iterator_category,
@@ -1211,6 +1232,10 @@ public:
   SmallVector() : SmallVectorImpl<T>(N) {}
 
   ~SmallVector() {
+#ifdef LLVM_ENABLE_SMALLVECTOR_STATS
+    detail::recordSmallVectorLifetime(getTypeName<T>(), sizeof(T), N,
+                                      this->capacity(), !this->isSmall());
+#endif
     // Destroy the constructed elements in the vector.
     this->destroy_range(this->begin(), this->end());
   }
@@ -1617,6 +1617,19 @@ public:
                              RegisterDependenciesFunction RegisterDependencies =
                                  NoDependenciesToRegister);
 
+  /// Blocking lookup for a batch of independent symbol queries sharing one
+  /// search order. All queries are issued before any result is waited on, so
+  /// materialization for the whole batch is scheduled in a single pass rather
+  /// than one session transaction per set. Results are returned in the same
+  /// order as the input sets. If any query fails the errors are joined and
+  /// returned after all queries have completed.
+  Expected<std::vector<SymbolMap>>
+  lookup(const JITDylibSearchOrder &SearchOrder,
+         ArrayRef<SymbolLookupSet> Batch, LookupKind K = LookupKind::Static,
+         SymbolState RequiredState = SymbolState::Ready,
+         RegisterDependenciesFunction RegisterDependencies =
+             NoDependenciesToRegister);
+
   /// Convenience version of blocking lookup.
   /// Searches each of the JITDylibs in the search order in turn for the given
   /// symbol.
@@ -466,7 +466,12 @@ public:
 private:
   // Implementation of pass instrumentation callbacks.
   void runBeforePass(StringRef PassID, Any IR);
-  void runAfterPass();
+  void runAfterPass(StringRef PassID, Any IR);
+
+  // Instruction counts recorded on entry to each open pass section, used to
+  // emit instant events for passes that change the IR size. -1 for IR units
+  // whose instructions we do not count.
+  SmallVector<int64_t, 8> InstrCountStack;
 };
 
 // Class that holds transitions between basic blocks.  The transitions
@@ -89,8 +89,12 @@ TimeTraceProfiler *getTimeTraceProfilerInstance();
 /// Initialize the time trace profiler.
 /// This sets up the global \p TimeTraceProfilerInstance
 /// variable to be the profiler instance.
+/// If \p TimeTraceMemory is true, each time section additionally records the
+/// change in malloc'd heap memory between its begin and end, at the cost of
+/// querying the allocator on every section boundary.
 void timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
-                                 StringRef ProcName);
+                                 StringRef ProcName,
+                                 bool TimeTraceMemory = false);
 
 /// Cleanup the time trace profiler, if it was initialized.
 void timeTraceProfilerCleanup();
@@ -127,6 +131,13 @@ void timeTraceProfilerBegin(StringRef Name,
 /// Manually end the last time section.
 void timeTraceProfilerEnd();
 
+/// Add an instant event to the trace, with the given \p Name and \p Detail.
+/// Instant events have no duration; they render as markers and are useful for
+/// annotating points of interest (e.g. state changes) inside time sections.
+/// \p Detail is only evaluated if the profiler is initialized.
+void timeTraceAddInstantEvent(StringRef Name,
+                              llvm::function_ref<std::string()> Detail);
+
 /// The TimeTraceScope is a helper class to call the begin and end functions
 /// of the time trace profiler.  When the object is constructed, it begins
 /// the section; and when it is destroyed, it stops it. If the time profiler
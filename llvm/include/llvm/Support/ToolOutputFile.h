@@ -45,14 +45,24 @@ class ToolOutputFile {
   /// intentionally declared after Installer.
   std::optional<raw_fd_ostream> OSHolder;
 
+  /// Storage for the stream when the client asked for a seekable read/write
+  /// stream (see the Streamable constructor flag). Writers like the bitcode
+  /// writer detect this stream kind and flush incrementally instead of
+  /// buffering the whole output in memory.
+  std::optional<raw_fd_stream> FDSHolder;
+
   /// The actual stream to use.
   raw_fd_ostream *OS;
 
 public:
   /// This constructor's arguments are passed to raw_fd_ostream's
-  /// constructor.
+  /// constructor. If \p Streamable is true and \p Filename names a regular
+  /// file, the underlying stream is a raw_fd_stream, which supports reading
+  /// back what has been written and therefore lets stream-aware writers
+  /// (e.g. WriteBitcodeToFile) flush incrementally; when the target is not a
+  /// regular file this silently degrades to a plain raw_fd_ostream.
   ToolOutputFile(StringRef Filename, std::error_code &EC,
-                 sys::fs::OpenFlags Flags);
+                 sys::fs::OpenFlags Flags, bool Streamable = false);
 
   ToolOutputFile(StringRef Filename, int FD);
 
@@ -142,6 +142,10 @@ STATISTIC(NumExitCountsNotComputed,
           "Number of loop exits without predictable exit counts");
 STATISTIC(NumBruteForceTripCountsComputed,
           "Number of loops with trip counts computed by force");
+STATISTIC(NumSCEVLookupHits,
+          "Number of SCEV queries answered from the value-expression cache");
+STATISTIC(NumSCEVLookupMisses,
+          "Number of SCEV queries that required (re)constructing expressions");
 
 #ifdef EXPENSIVE_CHECKS
 bool llvm::VerifySCEV = true;
@@ -4564,8 +4568,11 @@ void ScalarEvolution::insertValueToMap(Value *V, const SCEV *S) {
 const SCEV *ScalarEvolution::getSCEV(Value *V) {
   assert(isSCEVable(V->getType()) && "Value is not SCEVable!");
 
-  if (const SCEV *S = getExistingSCEV(V))
+  if (const SCEV *S = getExistingSCEV(V)) {
+    ++NumSCEVLookupHits;
     return S;
+  }
+  ++NumSCEVLookupMisses;
   return createSCEVIter(V);
 }
 
@@ -515,6 +515,7 @@ void RAGreedy::evictInterference(const LiveInterval &VirtReg,
            "Cannot decrease cascade number, illegal eviction");
     ExtraInfo->setCascade(Intf->reg(), Cascade);
     ++NumEvicted;
+    ++NumEvictionsInFunction;
     NewVRegs.push_back(Intf->reg());
   }
 }
@@ -2674,7 +2675,7 @@ void RAGreedy::reportStats() {
   for (MachineBasicBlock &MBB : *MF)
     if (!Loops->getLoopFor(&MBB))
       Stats.add(computeStats(MBB));
-  if (!Stats.isEmpty()) {
+  if (!Stats.isEmpty() || NumEvictionsInFunction) {
     using namespace ore;
 
     ORE->emit([&]() {
@@ -2684,6 +2685,9 @@ void RAGreedy::reportStats() {
       MachineOptimizationRemarkMissed R(DEBUG_TYPE, "SpillReloadCopies", Loc,
                                         &MF->front());
       Stats.report(R);
+      if (NumEvictionsInFunction)
+        R << NV("NumEvictions", NumEvictionsInFunction)
+          << " interference evictions ";
       R << "generated in function";
       return R;
     });
@@ -2767,6 +2771,7 @@ bool RAGreedy::runOnMachineFunction(MachineFunction &mf) {
   IntfCache.init(MF, Matrix->getLiveUnions(), Indexes, LIS, TRI);
   GlobalCand.resize(32);  // This will grow as needed.
   SetOfBrokenHints.clear();
+  NumEvictionsInFunction = 0;
 
   allocatePhysRegs();
   tryHintsRecoloring();
@@ -188,6 +188,12 @@ private:
 
   std::unique_ptr<RegAllocPriorityAdvisor> PriorityAdvisor;
 
+  /// Number of interferences evicted while allocating the current function,
+  /// surfaced through the function-level SpillReloadCopies remark so that
+  /// functions burning allocator time in evict/requeue churn can be found
+  /// from remark output.
+  unsigned NumEvictionsInFunction = 0;
+
   // Enum CutOffStage to keep a track whether the register allocation failed
   // because of the cutoffs encountered in last chance recoloring.
   // Note: This is used as bitmask. New value should be next power of 2.
@@ -1405,8 +1405,10 @@ SDNode *SelectionDAG::FindNodeOrInsertPos(const FoldingSetNodeID &ID,
 
 void SelectionDAG::clear() {
   allnodes_clear();
-  OperandRecycler.clear(OperandAllocator);
-  OperandAllocator.Reset();
+  // allnodes_clear() returned every operand array to OperandRecycler, so keep
+  // the recycler's free lists and OperandAllocator's slabs for the next block
+  // instead of tearing the pool down; SDNode memory is already retained the
+  // same way by NodeAllocator. The destructor releases both pools.
   CSEMap.clear();
 
   ExtendedValueTypeNodes.clear();
@@ -14,6 +14,7 @@
 #define LIB_EXECUTIONENGINE_JITLINK_JITLINKGENERIC_H
 
 #include "llvm/ExecutionEngine/JITLink/JITLink.h"
+#include "llvm/Support/Parallel.h"
 
 #define DEBUG_TYPE "jitlink"
 
@@ -135,7 +136,22 @@ private:
     for (auto &Sec : G.sections()) {
       bool NoAllocSection = Sec.getMemLifetime() == orc::MemLifetime::NoAlloc;
 
-      for (auto *B : Sec.blocks()) {
+      // Fixing up a block only writes that block's content and reads symbol
+      // addresses, which are final by this phase, so blocks can be fixed up
+      // in parallel. Gather the blocks first: block iteration order is not
+      // random-access, and for no-alloc sections making content mutable
+      // allocates on the graph's (non-thread-safe) allocator, so it has to
+      // happen up-front on this thread.
+      SmallVector<Block *, 0> Blocks(Sec.blocks());
+
+      // If this is a no-alloc section then copy each block's content into
+      // memory allocated on the Graph's allocator (if it hasn't been
+      // already).
+      if (NoAllocSection)
+        for (auto *B : Blocks)
+          (void)B->getMutableContent(G);
+
+      auto FixUpBlock = [&](Block *B) -> Error {
         LLVM_DEBUG(dbgs() << "  " << *B << ":\n");
 
         // Copy Block data and apply fixups.
@@ -147,12 +163,6 @@ private:
                                            })) &&
                "Non-KeepAlive edges in zero-fill block?");
 
-        // If this is a no-alloc section then copy the block content into
-        // memory allocated on the Graph's allocator (if it hasn't been
-        // already).
-        if (NoAllocSection)
-          (void)B->getMutableContent(G);
-
         for (auto &E : B->edges()) {
 
           // Skip non-relocation edges.
@@ -171,7 +181,12 @@ private:
           if (auto Err = impl().applyFixup(G, *B, E))
             return Err;
         }
-      }
+
+        return Error::success();
+      };
+
+      if (auto Err = parallelForEachError(Blocks, FixUpBlock))
+        return Err;
     }
 
     return Error::success();
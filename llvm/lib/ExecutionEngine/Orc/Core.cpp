@@ -1866,6 +1866,56 @@ ExecutionSession::lookup(const JITDylibSearchOrder &SearchOrder,
 #endif
 }
 
+Expected<std::vector<SymbolMap>>
+ExecutionSession::lookup(const JITDylibSearchOrder &SearchOrder,
+                         ArrayRef<SymbolLookupSet> Batch, LookupKind K,
+                         SymbolState RequiredState,
+                         RegisterDependenciesFunction RegisterDependencies) {
+  std::vector<SymbolMap> Results(Batch.size());
+  Error BatchError = Error::success();
+
+#if LLVM_ENABLE_THREADS
+  std::vector<std::promise<MSVCPExpected<SymbolMap>>> PromisedResults(
+      Batch.size());
+
+  // Issue every query before waiting on any of them so that materialization
+  // for independent sets overlaps instead of running one blocking transaction
+  // per set.
+  for (size_t I = 0; I != Batch.size(); ++I)
+    lookup(
+        K, SearchOrder, Batch[I], RequiredState,
+        [&PromisedResults, I](Expected<SymbolMap> R) {
+          PromisedResults[I].set_value(std::move(R));
+        },
+        RegisterDependencies);
+
+  for (size_t I = 0; I != Batch.size(); ++I) {
+    Expected<SymbolMap> R = PromisedResults[I].get_future().get();
+    if (R)
+      Results[I] = std::move(*R);
+    else
+      BatchError = joinErrors(std::move(BatchError), R.takeError());
+  }
+#else
+  // Without threads each query runs to completion inside the lookup call.
+  for (size_t I = 0; I != Batch.size(); ++I)
+    lookup(
+        K, SearchOrder, Batch[I], RequiredState,
+        [&, I](Expected<SymbolMap> R) {
+          if (R)
+            Results[I] = std::move(*R);
+          else
+            BatchError = joinErrors(std::move(BatchError), R.takeError());
+        },
+        RegisterDependencies);
+#endif
+
+  if (BatchError)
+    return std::move(BatchError);
+
+  return std::move(Results);
+}
+
 Expected<ExecutorSymbolDef>
 ExecutionSession::lookup(const JITDylibSearchOrder &SearchOrder,
                          SymbolStringPtr Name, SymbolState RequiredState) {
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/IR/PassManager.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/IR/PassManagerImpl.h"
 #include <optional>
 
@@ -109,10 +110,20 @@ PreservedAnalyses ModuleToFunctionPassAdaptor::run(Module &M,
   // instrumenting callbacks for the passes later.
   PassInstrumentation PI = AM.getResult<PassInstrumentationAnalysis>(M);
 
+  // Snapshot the worklist of functions up front. The function-pass contract
+  // (restated below when we preserve the proxy) is that passes do not add or
+  // remove functions from the module, so the snapshot cannot go stale; it
+  // decouples the dispatch order from the module's function list, which is a
+  // prerequisite for eventually distributing independent functions across
+  // workers.
+  SmallVector<Function *, 16> Worklist;
+  for (Function &F : M)
+    if (!F.isDeclaration())
+      Worklist.push_back(&F);
+
   PreservedAnalyses PA = PreservedAnalyses::all();
-  for (Function &F : M) {
-    if (F.isDeclaration())
-      continue;
+  for (Function *FPtr : Worklist) {
+    Function &F = *FPtr;
 
     // Check the PassInstrumentation's BeforePass callbacks before running the
     // pass, skip its execution completely if asked to (callback returns
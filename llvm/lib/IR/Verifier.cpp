@@ -116,6 +116,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <algorithm>
 #include <cassert>
@@ -124,6 +125,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace llvm;
 
@@ -383,6 +385,40 @@ public:
 
   bool hasBrokenDebugInfo() const { return BrokenDebugInfo; }
 
+  /// Fold the cross-function state collected by \p Other, which verified a
+  /// disjoint subset of this module's functions, into this verifier so that
+  /// the module-level phase sees the union of what every function verifier
+  /// saw. Returns false if the merge itself uncovered a failure.
+  bool mergeCrossFunctionState(const Verifier &Other) {
+    BrokenDebugInfo |= Other.BrokenDebugInfo;
+
+    // A function's llvm.localescape count is recorded by the verifier that
+    // visited the function; llvm.localrecover uses of it may have been seen
+    // by any verifier. Combine with max so that verifyFrameRecoverIndices()
+    // checks recover indices against the escape counts from all subsets.
+    for (const auto &KV : Other.FrameEscapeInfo) {
+      auto &Entry = FrameEscapeInfo[KV.first];
+      Entry.first = std::max(Entry.first, KV.second.first);
+      Entry.second = std::max(Entry.second, KV.second.second);
+    }
+
+    CUVisited.insert(Other.CUVisited.begin(), Other.CUVisited.end());
+
+    // Redo the one cross-function debug info check a partitioned visit cannot
+    // see on its own: a DISubprogram attached to functions in different
+    // subsets.
+    for (const auto &KV : Other.DISubprogramAttachments) {
+      const Function *&AttachedTo = DISubprogramAttachments[KV.first];
+      if (AttachedTo && AttachedTo != KV.second)
+        DebugInfoCheckFailed("DISubprogram attached to more than one function",
+                             KV.first, KV.second);
+      else
+        AttachedTo = KV.second;
+    }
+
+    return !Broken;
+  }
+
   bool verify(const Function &F) {
     assert(F.getParent() == &M &&
            "An instance of this class only works with a specific module!");
@@ -6722,9 +6758,49 @@ bool llvm::verifyModule(const Module &M, raw_ostream *OS,
   // Don't use a raw_null_ostream.  Printing IR is expensive.
   Verifier V(OS, /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
 
-  bool Broken = false;
+  SmallVector<const Function *, 0> Fns;
   for (const Function &F : M)
-    Broken |= !V.verify(F);
+    Fns.push_back(&F);
+
+  bool Broken = false;
+  size_t NumShards =
+      std::min<size_t>(Fns.size(), parallel::strategy.compute_thread_count());
+  if (NumShards > 1) {
+    // Function-level verification only reads the IR and is independent per
+    // function apart from a small amount of cross-function state, so verify
+    // disjoint contiguous shards of the function list in parallel, each with
+    // its own verifier and diagnostic buffer, and then fold the shards' state
+    // into V before the module-level phase. Buffers are flushed in shard
+    // order, so diagnostics appear in the same order as a serial walk.
+    struct Shard {
+      SmallString<0> Log;
+      std::optional<raw_svector_ostream> LogOS;
+      std::optional<Verifier> V;
+      bool Broken = false;
+    };
+    std::vector<Shard> Shards(NumShards);
+    for (Shard &S : Shards) {
+      if (OS)
+        S.LogOS.emplace(S.Log);
+      S.V.emplace(OS ? &*S.LogOS : nullptr,
+                  /*ShouldTreatBrokenDebugInfoAsError=*/!BrokenDebugInfo, M);
+    }
+    parallelFor(0, NumShards, [&](size_t I) {
+      size_t Begin = Fns.size() * I / NumShards;
+      size_t End = Fns.size() * (I + 1) / NumShards;
+      for (size_t FI = Begin; FI != End; ++FI)
+        Shards[I].Broken |= !Shards[I].V->verify(*Fns[FI]);
+    });
+    for (Shard &S : Shards) {
+      Broken |= S.Broken;
+      if (OS)
+        *OS << S.Log;
+      Broken |= !V.mergeCrossFunctionState(*S.V);
+    }
+  } else {
+    for (const Function *F : Fns)
+      Broken |= !V.verify(*F);
+  }
 
   Broken |= !V.verify();
   if (BrokenDebugInfo)
@@ -549,6 +549,32 @@ static void CheckBundleSubtargets(const MCSubtargetInfo *OldSTI,
 void MCELFStreamer::emitInstToData(const MCInst &Inst,
                                    const MCSubtargetInfo &STI) {
   MCAssembler &Assembler = getAssembler();
+
+  // In the common case, when bundling is disabled, the instruction is encoded
+  // straight into the current data fragment: emitters append to the buffer
+  // they are handed and produce instruction-relative fixup offsets, so all
+  // that is needed afterwards is rebasing the new fixups on the fragment
+  // offset where this instruction starts. This avoids a temporary buffer and
+  // a copy per instruction.
+  if (!Assembler.isBundlingEnabled()) {
+    MCDataFragment *DF = getOrCreateDataFragment(&STI);
+    size_t CodeOffset = DF->getContents().size();
+    size_t FixupStart = DF->getFixups().size();
+    Assembler.getEmitter().encodeInstruction(Inst, DF->getContents(),
+                                             DF->getFixups(), STI);
+    for (MCFixup &Fixup : llvm::drop_begin(DF->getFixups(), FixupStart)) {
+      Fixup.setOffset(Fixup.getOffset() + CodeOffset);
+      fixSymbolsInTLSFixups(Fixup.getValue());
+    }
+
+    DF->setHasInstructions(STI);
+    if (DF->getFixups().size() != FixupStart &&
+        DF->getFixups().back().getTargetKind() ==
+            getAssembler().getBackend().RelaxFixupKind)
+      DF->setLinkerRelaxable();
+    return;
+  }
+
   SmallVector<MCFixup, 4> Fixups;
   SmallString<256> Code;
   Assembler.getEmitter().encodeInstruction(Inst, Code, Fixups, STI);
@@ -556,13 +582,7 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
   for (auto &Fixup : Fixups)
     fixSymbolsInTLSFixups(Fixup.getValue());
 
-  // There are several possibilities here:
-  //
-  // If bundling is disabled, append the encoded instruction to the current data
-  // fragment (or create a new such fragment if the current fragment is not a
-  // data fragment, or the Subtarget has changed).
-  //
-  // If bundling is enabled:
+  // Bundling is enabled:
   // - If we're not in a bundle-locked group, emit the instruction into a
   //   fragment of its own. If there are no fixups registered for the
   //   instruction, emit a MCCompactEncodedInstFragment. Otherwise, emit a
@@ -573,7 +593,7 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
   //   the group, though.
   MCDataFragment *DF;
 
-  if (Assembler.isBundlingEnabled()) {
+  {
     MCSection &Sec = *getCurrentSectionOnly();
     if (Assembler.getRelaxAll() && isBundleLocked()) {
       // If the -mc-relax-all flag is used and we are bundle-locked, we re-use
@@ -616,8 +636,6 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
     // We're now emitting an instruction in a bundle group, so this flag has
     // to be turned off.
     Sec.setBundleGroupBeforeFirstInst(false);
-  } else {
-    DF = getOrCreateDataFragment(&STI);
   }
 
   // Add the fixups and data.
@@ -632,11 +650,9 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
     DF->setLinkerRelaxable();
   DF->getContents().append(Code.begin(), Code.end());
 
-  if (Assembler.isBundlingEnabled() && Assembler.getRelaxAll()) {
-    if (!isBundleLocked()) {
-      mergeFragment(getOrCreateDataFragment(&STI), DF);
-      delete DF;
-    }
+  if (Assembler.getRelaxAll() && !isBundleLocked()) {
+    mergeFragment(getOrCreateDataFragment(&STI), DF);
+    delete DF;
   }
 }
 
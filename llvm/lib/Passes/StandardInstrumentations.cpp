@@ -16,6 +16,7 @@
 #include "llvm/ADT/Any.h"
 #include "llvm/ADT/StableHashing.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/Twine.h"
 #include "llvm/Analysis/CallGraphSCCPass.h"
 #include "llvm/Analysis/LazyCallGraph.h"
 #include "llvm/Analysis/LoopInfo.h"
@@ -1482,23 +1483,51 @@ void TimeProfilingPassesHandler::registerCallbacks(
       [this](StringRef P, Any IR) { this->runBeforePass(P, IR); });
   PIC.registerAfterPassCallback(
       [this](StringRef P, Any IR, const PreservedAnalyses &) {
-        this->runAfterPass();
+        this->runAfterPass(P, IR);
       },
       true);
   PIC.registerAfterPassInvalidatedCallback(
-      [this](StringRef P, const PreservedAnalyses &) { this->runAfterPass(); },
+      [this](StringRef P, const PreservedAnalyses &) {
+        this->runAfterPass(P, Any());
+      },
       true);
   PIC.registerBeforeAnalysisCallback(
-      [this](StringRef P, Any IR) { this->runBeforePass(P, IR); });
+      [](StringRef P, Any IR) { timeTraceProfilerBegin(P, getIRName(IR)); });
   PIC.registerAfterAnalysisCallback(
-      [this](StringRef P, Any IR) { this->runAfterPass(); }, true);
+      [](StringRef P, Any IR) { timeTraceProfilerEnd(); }, true);
+  PIC.registerAnalysisInvalidatedCallback([](StringRef P, Any IR) {
+    timeTraceAddInstantEvent("InvalidatedAnalysis", [&]() {
+      return (P + " on " + getIRName(IR)).str();
+    });
+  });
+}
+
+// Return the number of IR instructions in \p IR if it is a unit we track the
+// size of, otherwise -1.
+static int64_t getInstrCount(Any IR) {
+  if (const auto *M = unwrapIR<Module>(IR))
+    return M->getInstructionCount();
+  if (const auto *F = unwrapIR<Function>(IR))
+    return F->getInstructionCount();
+  return -1;
 }
 
 void TimeProfilingPassesHandler::runBeforePass(StringRef PassID, Any IR) {
   timeTraceProfilerBegin(PassID, getIRName(IR));
+  InstrCountStack.push_back(getInstrCount(IR));
 }
 
-void TimeProfilingPassesHandler::runAfterPass() { timeTraceProfilerEnd(); }
+void TimeProfilingPassesHandler::runAfterPass(StringRef PassID, Any IR) {
+  int64_t Before = InstrCountStack.pop_back_val();
+  int64_t After = IR.has_value() ? getInstrCount(IR) : -1;
+  if (Before >= 0 && After >= 0 && After != Before)
+    timeTraceAddInstantEvent("IRInstructionDelta", [&]() {
+      return (PassID + " on " + getIRName(IR) + ": " + Twine(Before) + " -> " +
+              Twine(After))
+          .str();
+    });
+  timeTraceProfilerEnd();
+}
 
 namespace {
 
@@ -45,6 +45,18 @@ inline static uint64_t* getMemory(unsigned numWords) {
   return new uint64_t[numWords];
 }
 
+#if defined(__SIZEOF_INT128__)
+/// A utility function to form a 128-bit value from the low words of an APInt.
+/// The caller must ensure no word above the first two is set.
+inline static __uint128_t makeU128(const APInt::WordType *Words,
+                                   unsigned NumWords) {
+  __uint128_t Value = Words[0];
+  if (NumWords == 2)
+    Value |= (__uint128_t)Words[1] << 64;
+  return Value;
+}
+#endif
+
 /// A utility function that converts a character to a digit.
 inline static unsigned getDigit(char cdigit, uint8_t radix) {
   unsigned r;
@@ -237,6 +249,17 @@ APInt APInt::operator*(const APInt& RHS) const {
     return APInt(BitWidth, U.VAL * RHS.U.VAL);
 
   APInt Result(getMemory(getNumWords()), getBitWidth());
+#if defined(__SIZEOF_INT128__)
+  if (getNumWords() == 2) {
+    // The product is truncated to the operand width, so the compiler's native
+    // 128-bit multiply computes exactly what tcMultiply would.
+    __uint128_t Product = makeU128(U.pVal, 2) * makeU128(RHS.U.pVal, 2);
+    Result.U.pVal[0] = (uint64_t)Product;
+    Result.U.pVal[1] = (uint64_t)(Product >> 64);
+    Result.clearUnusedBits();
+    return Result;
+  }
+#endif
   tcMultiply(Result.U.pVal, U.pVal, RHS.U.pVal, getNumWords());
   Result.clearUnusedBits();
   return Result;
@@ -1608,6 +1631,18 @@ APInt APInt::udiv(const APInt &RHS) const {
     // All high words are zero, just use native divide
     return APInt(BitWidth, this->U.pVal[0] / RHS.U.pVal[0]);
 
+#if defined(__SIZEOF_INT128__)
+  if (lhsWords == 2 && rhsWords <= 2) {
+    // Both values fit in 128 bits; native 128-bit division is much cheaper
+    // than the general Knuth algorithm.
+    __uint128_t Q = makeU128(U.pVal, 2) / makeU128(RHS.U.pVal, rhsWords);
+    APInt Quotient(BitWidth, 0);
+    Quotient.U.pVal[0] = (uint64_t)Q;
+    Quotient.U.pVal[1] = (uint64_t)(Q >> 64);
+    return Quotient;
+  }
+#endif
+
   // We have to compute it the hard way. Invoke the Knuth divide algorithm.
   APInt Quotient(BitWidth, 0); // to hold result.
   divide(U.pVal, lhsWords, RHS.U.pVal, rhsWords, Quotient.U.pVal, nullptr);
@@ -1641,6 +1676,18 @@ APInt APInt::udiv(uint64_t RHS) const {
     // All high words are zero, just use native divide
     return APInt(BitWidth, this->U.pVal[0] / RHS);
 
+#if defined(__SIZEOF_INT128__)
+  if (lhsWords == 2) {
+    // The dividend fits in 128 bits; native 128-bit division is much cheaper
+    // than the general Knuth algorithm.
+    __uint128_t Q = makeU128(U.pVal, 2) / RHS;
+    APInt Quotient(BitWidth, 0);
+    Quotient.U.pVal[0] = (uint64_t)Q;
+    Quotient.U.pVal[1] = (uint64_t)(Q >> 64);
+    return Quotient;
+  }
+#endif
+
   // We have to compute it the hard way. Invoke the Knuth divide algorithm.
   APInt Quotient(BitWidth, 0); // to hold result.
   divide(U.pVal, lhsWords, &RHS, 1, Quotient.U.pVal, nullptr);
@@ -1701,6 +1748,18 @@ APInt APInt::urem(const APInt &RHS) const {
     // All high words are zero, just use native remainder
     return APInt(BitWidth, U.pVal[0] % RHS.U.pVal[0]);
 
+#if defined(__SIZEOF_INT128__)
+  if (lhsWords == 2 && rhsWords <= 2) {
+    // Both values fit in 128 bits; native 128-bit remainder is much cheaper
+    // than the general Knuth algorithm.
+    __uint128_t R = makeU128(U.pVal, 2) % makeU128(RHS.U.pVal, rhsWords);
+    APInt Remainder(BitWidth, 0);
+    Remainder.U.pVal[0] = (uint64_t)R;
+    Remainder.U.pVal[1] = (uint64_t)(R >> 64);
+    return Remainder;
+  }
+#endif
+
   // We have to compute it the hard way. Invoke the Knuth divide algorithm.
   APInt Remainder(BitWidth, 0);
   divide(U.pVal, lhsWords, RHS.U.pVal, rhsWords, nullptr, Remainder.U.pVal);
@@ -1733,6 +1792,13 @@ uint64_t APInt::urem(uint64_t RHS) const {
     // All high words are zero, just use native remainder
     return U.pVal[0] % RHS;
 
+#if defined(__SIZEOF_INT128__)
+  if (lhsWords == 2)
+    // The dividend fits in 128 bits; native 128-bit remainder is much cheaper
+    // than the general Knuth algorithm.
+    return (uint64_t)(makeU128(U.pVal, 2) % RHS);
+#endif
+
   // We have to compute it the hard way. Invoke the Knuth divide algorithm.
   uint64_t Remainder;
   divide(U.pVal, lhsWords, &RHS, 1, nullptr, &Remainder);
@@ -1822,6 +1888,27 @@ void APInt::udivrem(const APInt &LHS, const APInt &RHS,
     return;
   }
 
+#if defined(__SIZEOF_INT128__)
+  if (lhsWords == 2 && rhsWords <= 2) {
+    // Both values fit in 128 bits; native 128-bit division is much cheaper
+    // than the general Knuth algorithm. Read both operands up front in case
+    // Quotient or Remainder aliases LHS or RHS.
+    __uint128_t lhsValue = makeU128(LHS.U.pVal, 2);
+    __uint128_t rhsValue = makeU128(RHS.U.pVal, rhsWords);
+    __uint128_t Q = lhsValue / rhsValue;
+    __uint128_t R = lhsValue % rhsValue;
+    Quotient.U.pVal[0] = (uint64_t)Q;
+    Quotient.U.pVal[1] = (uint64_t)(Q >> 64);
+    Remainder.U.pVal[0] = (uint64_t)R;
+    Remainder.U.pVal[1] = (uint64_t)(R >> 64);
+    std::memset(Quotient.U.pVal + 2, 0,
+                (getNumWords(BitWidth) - 2) * APINT_WORD_SIZE);
+    std::memset(Remainder.U.pVal + 2, 0,
+                (getNumWords(BitWidth) - 2) * APINT_WORD_SIZE);
+    return;
+  }
+#endif
+
   // Okay, lets do it the long way
   divide(LHS.U.pVal, lhsWords, RHS.U.pVal, rhsWords, Quotient.U.pVal,
          Remainder.U.pVal);
@@ -66,6 +66,9 @@
 #include <stdio.h>
 #endif
 #include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 /*
  * This code extensively uses fall-through switches.
@@ -554,6 +557,19 @@ unsigned getNumBytesForUTF8(UTF8 first) {
  */
 Boolean isLegalUTF8String(const UTF8 **source, const UTF8 *sourceEnd) {
     while (*source != sourceEnd) {
+        /*
+         * Fast path: a whole word of one-byte (ASCII) sequences is trivially
+         * legal, and most real-world input is dominated by such runs.
+         */
+        while (sourceEnd - *source >= (ptrdiff_t)sizeof(uintptr_t)) {
+            uintptr_t word;
+            memcpy(&word, *source, sizeof(word));
+            if (word & (uintptr_t)UINT64_C(0x8080808080808080))
+                break;
+            *source += sizeof(word);
+        }
+        if (*source == sourceEnd)
+            break;
         int length = trailingBytesForUTF8[**source] + 1;
         if (length > sourceEnd - *source || !isLegalUTF8(*source, length))
             return false;
@@ -572,7 +588,31 @@ ConversionResult ConvertUTF8toUTF16 (
     UTF16* target = *targetStart;
     while (source < sourceEnd) {
         UTF32 ch = 0;
-        unsigned short extraBytesToRead = trailingBytesForUTF8[*source];
+        unsigned short extraBytesToRead;
+        /*
+         * Bulk-convert runs of ASCII, which map 1:1 onto UTF-16 code units.
+         * Whole words are tested at once; the byte loop mops up the tail and
+         * stops at the first lead byte that needs real decoding. Exhaustion
+         * of the target mid-run is reported by the general path below.
+         */
+        if (*source < 0x80) {
+            while (sourceEnd - source >= 8 && targetEnd - target >= 8) {
+                uint64_t word;
+                memcpy(&word, source, sizeof(word));
+                if (word & UINT64_C(0x8080808080808080))
+                    break;
+                target[0] = source[0]; target[1] = source[1];
+                target[2] = source[2]; target[3] = source[3];
+                target[4] = source[4]; target[5] = source[5];
+                target[6] = source[6]; target[7] = source[7];
+                source += 8; target += 8;
+            }
+            while (source < sourceEnd && target < targetEnd && *source < 0x80)
+                *target++ = *source++;
+            if (source == sourceEnd)
+                break;
+        }
+        extraBytesToRead = trailingBytesForUTF8[*source];
         if (extraBytesToRead >= sourceEnd - source) {
             result = sourceExhausted; break;
         }
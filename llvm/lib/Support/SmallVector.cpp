@@ -11,9 +11,16 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/MemAlloc.h"
+#include "llvm/Support/raw_ostream.h"
 #include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
 #ifdef LLVM_ENABLE_EXCEPTIONS
 #include <stdexcept>
 #endif
@@ -156,6 +163,98 @@ void SmallVectorBase<Size_T>::grow_pod(void *FirstEl, size_t MinSize,
   this->set_allocation_range(NewElts, NewCapacity);
 }
 
+namespace {
+/// Aggregated lifetime data for one SmallVector<T, N> instantiation, keyed by
+/// the (TypeName, InlineElts) pair in the collector below.
+struct SmallVectorSiteStats {
+  size_t EltSize = 0;
+  uint64_t Lifetimes = 0;
+  uint64_t Spills = 0;
+  uint64_t MaxCapacity = 0;
+  /// Sum of FinalCapacity * EltSize over spilled lifetimes: the total heap
+  /// traffic attributable to this instantiation's inline size being too small.
+  uint64_t HeapBytes = 0;
+};
+
+/// Collector behind LLVM_ENABLE_SMALLVECTOR_STATS. Deliberately built on
+/// std::map/std::mutex rather than LLVM containers so that recording a
+/// lifetime never constructs a SmallVector itself.
+class SmallVectorStatsCollector {
+  std::mutex Lock;
+  bool Reporting = false;
+  std::map<std::pair<StringRef, size_t>, SmallVectorSiteStats> Sites;
+
+public:
+  void record(StringRef TypeName, size_t EltSize, size_t InlineElts,
+              size_t FinalCapacity, bool Spilled) {
+    std::lock_guard<std::mutex> Guard(Lock);
+    // Ignore vectors destroyed while the report itself is being printed.
+    if (Reporting)
+      return;
+    SmallVectorSiteStats &S = Sites[{TypeName, InlineElts}];
+    S.EltSize = EltSize;
+    ++S.Lifetimes;
+    S.MaxCapacity = std::max<uint64_t>(S.MaxCapacity, FinalCapacity);
+    if (Spilled) {
+      ++S.Spills;
+      S.HeapBytes += uint64_t(FinalCapacity) * EltSize;
+    }
+  }
+
+  ~SmallVectorStatsCollector() {
+    std::lock_guard<std::mutex> Guard(Lock);
+    Reporting = true;
+    if (Sites.empty())
+      return;
+
+    // Rank by spill frequency times allocation cost, i.e. total heap bytes.
+    std::vector<const std::pair<const std::pair<StringRef, size_t>,
+                                SmallVectorSiteStats> *> Sorted;
+    Sorted.reserve(Sites.size());
+    for (const auto &KV : Sites)
+      Sorted.push_back(&KV);
+    std::stable_sort(Sorted.begin(), Sorted.end(),
+                     [](const auto *LHS, const auto *RHS) {
+                       if (LHS->second.HeapBytes != RHS->second.HeapBytes)
+                         return LHS->second.HeapBytes > RHS->second.HeapBytes;
+                       return LHS->second.Lifetimes > RHS->second.Lifetimes;
+                     });
+
+    raw_ostream &OS = errs();
+    OS << "===" << std::string(73, '-') << "===\n"
+       << "                       SmallVector Usage Statistics\n"
+       << "===" << std::string(73, '-') << "===\n\n";
+    OS << "   Lifetimes       Spills   Spill%   MaxCap      HeapBytes  "
+          "Instantiation\n";
+    for (const auto *KV : Sorted) {
+      const SmallVectorSiteStats &S = KV->second;
+      OS << format("%12llu %12llu %7.2f%% %8llu %14llu  ",
+                   (unsigned long long)S.Lifetimes,
+                   (unsigned long long)S.Spills,
+                   S.Lifetimes ? 100.0 * S.Spills / S.Lifetimes : 0.0,
+                   (unsigned long long)S.MaxCapacity,
+                   (unsigned long long)S.HeapBytes)
+         << "SmallVector<" << KV->first.first << ", " << KV->first.second
+         << ">\n";
+    }
+    OS << '\n';
+    OS.flush();
+  }
+};
+} // end anonymous namespace
+
+static ManagedStatic<SmallVectorStatsCollector> SmallVectorStats;
+
+// Defined even when LLVM_ENABLE_SMALLVECTOR_STATS is off so that clients
+// compiled with the macro can link against a library built without it.
+void llvm::detail::recordSmallVectorLifetime(StringRef TypeName, size_t EltSize,
+                                             size_t InlineElts,
+                                             size_t FinalCapacity,
+                                             bool Spilled) {
+  SmallVectorStats->record(TypeName, EltSize, InlineElts, FinalCapacity,
+                           Spilled);
+}
+
 template class llvm::SmallVectorBase<uint32_t>;
 
 // Disable the uint64_t instantiation for 32-bit builds.
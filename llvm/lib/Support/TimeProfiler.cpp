@@ -70,6 +70,10 @@ struct TimeTraceProfilerEntry {
   TimePointType End;
   const std::string Name;
   const std::string Detail;
+  // Heap bytes malloc'd when the section was opened, and the change over the
+  // section's lifetime. Only maintained when memory tracking is enabled.
+  int64_t MemAtStart = 0;
+  int64_t MemDelta = 0;
 
   TimeTraceProfilerEntry(TimePointType &&S, TimePointType &&E, std::string &&N,
                          std::string &&Dt)
@@ -95,22 +99,34 @@ struct TimeTraceProfilerEntry {
 } // anonymous namespace
 
 struct llvm::TimeTraceProfiler {
-  TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "")
+  TimeTraceProfiler(unsigned TimeTraceGranularity = 0, StringRef ProcName = "",
+                    bool TimeTraceMemory = false)
       : BeginningOfTime(system_clock::now()), StartTime(ClockType::now()),
         ProcName(ProcName), Pid(sys::Process::getProcessId()),
-        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity) {
+        Tid(llvm::get_threadid()), TimeTraceGranularity(TimeTraceGranularity),
+        TimeTraceMemory(TimeTraceMemory) {
     llvm::get_thread_name(ThreadName);
   }
 
   void begin(std::string Name, llvm::function_ref<std::string()> Detail) {
     Stack.emplace_back(ClockType::now(), TimePointType(), std::move(Name),
                        Detail());
+    if (TimeTraceMemory)
+      Stack.back().MemAtStart = sys::Process::GetMallocUsage();
+  }
+
+  void instant(std::string Name, llvm::function_ref<std::string()> Detail) {
+    InstantEvents.emplace_back(ClockType::now(), TimePointType(),
+                               std::move(Name), Detail());
   }
 
   void end() {
     assert(!Stack.empty() && "Must call begin() first");
     TimeTraceProfilerEntry &E = Stack.back();
     E.End = ClockType::now();
+    if (TimeTraceMemory)
+      E.MemDelta =
+          static_cast<int64_t>(sys::Process::GetMallocUsage()) - E.MemAtStart;
 
     // Check that end times monotonically increase.
     assert((Entries.empty() ||
@@ -161,7 +177,7 @@ struct llvm::TimeTraceProfiler {
     J.arrayBegin();
 
     // Emit all events for the main flame graph.
-    auto writeEvent = [&](const auto &E, uint64_t Tid) {
+    auto writeEvent = [&](const auto &E, uint64_t Tid, bool WithMemory) {
       auto StartUs = E.getFlameGraphStartUs(StartTime);
       auto DurUs = E.getFlameGraphDurUs();
 
@@ -172,16 +188,42 @@ struct llvm::TimeTraceProfiler {
         J.attribute("ts", StartUs);
         J.attribute("dur", DurUs);
         J.attribute("name", E.Name);
-        if (!E.Detail.empty()) {
-          J.attributeObject("args", [&] { J.attribute("detail", E.Detail); });
+        if (!E.Detail.empty() || WithMemory) {
+          J.attributeObject("args", [&] {
+            if (!E.Detail.empty())
+              J.attribute("detail", E.Detail);
+            if (WithMemory)
+              J.attribute("malloc delta", E.MemDelta);
+          });
         }
       });
     };
     for (const TimeTraceProfilerEntry &E : Entries)
-      writeEvent(E, this->Tid);
+      writeEvent(E, this->Tid, TimeTraceMemory);
     for (const TimeTraceProfiler *TTP : Instances.List)
       for (const TimeTraceProfilerEntry &E : TTP->Entries)
-        writeEvent(E, TTP->Tid);
+        writeEvent(E, TTP->Tid, TTP->TimeTraceMemory);
+
+    // Emit instant events as thread-scoped markers.
+    auto writeInstantEvent = [&](const TimeTraceProfilerEntry &E,
+                                 uint64_t Tid) {
+      J.object([&] {
+        J.attribute("pid", Pid);
+        J.attribute("tid", int64_t(Tid));
+        J.attribute("ph", "i");
+        J.attribute("s", "t");
+        J.attribute("ts", E.getFlameGraphStartUs(StartTime));
+        J.attribute("name", E.Name);
+        if (!E.Detail.empty()) {
+          J.attributeObject("args", [&] { J.attribute("detail", E.Detail); });
+        }
+      });
+    };
+    for (const TimeTraceProfilerEntry &E : InstantEvents)
+      writeInstantEvent(E, this->Tid);
+    for (const TimeTraceProfiler *TTP : Instances.List)
+      for (const TimeTraceProfilerEntry &E : TTP->InstantEvents)
+        writeInstantEvent(E, TTP->Tid);
 
     // Emit totals by section name as additional "thread" events, sorted from
     // longest one.
@@ -271,6 +313,7 @@ struct llvm::TimeTraceProfiler {
 
   SmallVector<TimeTraceProfilerEntry, 16> Stack;
   SmallVector<TimeTraceProfilerEntry, 128> Entries;
+  SmallVector<TimeTraceProfilerEntry, 8> InstantEvents;
   StringMap<CountAndDurationType> CountAndTotalPerName;
   // System clock time when the session was begun.
   const time_point<system_clock> BeginningOfTime;
@@ -283,14 +326,19 @@ struct llvm::TimeTraceProfiler {
 
   // Minimum time granularity (in microseconds)
   const unsigned TimeTraceGranularity;
+
+  // Whether to record malloc'd-heap deltas for each entry.
+  const bool TimeTraceMemory;
 };
 
 void llvm::timeTraceProfilerInitialize(unsigned TimeTraceGranularity,
-                                       StringRef ProcName) {
+                                       StringRef ProcName,
+                                       bool TimeTraceMemory) {
   assert(TimeTraceProfilerInstance == nullptr &&
          "Profiler should not be initialized");
   TimeTraceProfilerInstance = new TimeTraceProfiler(
-      TimeTraceGranularity, llvm::sys::path::filename(ProcName));
+      TimeTraceGranularity, llvm::sys::path::filename(ProcName),
+      TimeTraceMemory);
 }
 
 // Removes all TimeTraceProfilerInstances.
@@ -357,3 +405,9 @@ void llvm::timeTraceProfilerEnd() {
   if (TimeTraceProfilerInstance != nullptr)
     TimeTraceProfilerInstance->end();
 }
+
+void llvm::timeTraceAddInstantEvent(StringRef Name,
+                                    llvm::function_ref<std::string()> Detail) {
+  if (TimeTraceProfilerInstance != nullptr)
+    TimeTraceProfilerInstance->instant(std::string(Name), Detail);
+}
@@ -23,6 +23,7 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/RWMutex.h"
 #include "llvm/Support/Signposts.h"
 #include "llvm/Support/YAMLTraits.h"
 #include "llvm/Support/raw_ostream.h"
@@ -242,6 +243,15 @@ typedef StringMap<Timer> Name2TimerMap;
 
 class Name2PairMap {
   StringMap<std::pair<TimerGroup*, Name2TimerMap> > Map;
+
+  // Guards Map. Lookups vastly outnumber insertions: every NamedRegionTimer
+  // constructed with timing enabled goes through get(), so existing timers
+  // are found under the shared lock and the exclusive lock is only taken the
+  // first time a group or timer name is seen. StringMap entries are
+  // heap-allocated, so references handed out under the shared lock stay
+  // valid across later insertions.
+  sys::SmartRWMutex<true> Lock;
+
 public:
   ~Name2PairMap() {
     for (StringMap<std::pair<TimerGroup*, Name2TimerMap> >::iterator
@@ -251,7 +261,19 @@ public:
 
   Timer &get(StringRef Name, StringRef Description, StringRef GroupName,
              StringRef GroupDescription) {
-    sys::SmartScopedLock<true> L(*TimerLock);
+    {
+      sys::SmartScopedReader<true> R(Lock);
+      StringMap<std::pair<TimerGroup *, Name2TimerMap>>::iterator GroupIt =
+          Map.find(GroupName);
+      if (GroupIt != Map.end() && GroupIt->second.first) {
+        Name2TimerMap::iterator TimerIt = GroupIt->second.second.find(Name);
+        if (TimerIt != GroupIt->second.second.end() &&
+            TimerIt->second.isInitialized())
+          return TimerIt->second;
+      }
+    }
+
+    sys::SmartScopedWriter<true> W(Lock);
 
     std::pair<TimerGroup*, Name2TimerMap> &GroupEntry = Map[GroupName];
 
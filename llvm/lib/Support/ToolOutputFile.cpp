@@ -38,13 +38,23 @@ ToolOutputFile::CleanupInstaller::~CleanupInstaller() {
 }
 
 ToolOutputFile::ToolOutputFile(StringRef Filename, std::error_code &EC,
-                               sys::fs::OpenFlags Flags)
+                               sys::fs::OpenFlags Flags, bool Streamable)
     : Installer(Filename) {
   if (isStdout(Filename)) {
     OS = &outs();
     EC = std::error_code();
     return;
   }
+  if (Streamable) {
+    FDSHolder.emplace(Filename, EC);
+    if (!EC) {
+      OS = &*FDSHolder;
+      return;
+    }
+    // Not a regular file (e.g. /dev/null); fall back to a plain stream.
+    FDSHolder.reset();
+    EC = std::error_code();
+  }
   OSHolder.emplace(Filename, EC, Flags);
   OS = &*OSHolder;
   // If open fails, no cleanup is needed.
@@ -120,6 +120,8 @@ STATISTIC(NumThreeIterations, "Number of functions with three iterations");
 STATISTIC(NumFourOrMoreIterations,
           "Number of functions with four or more iterations");
 
+STATISTIC(NumRevisits, "Number of instructions visited more than once in one "
+                       "invocation");
 STATISTIC(NumCombined , "Number of insts combined");
 STATISTIC(NumConstProp, "Number of constant folds");
 STATISTIC(NumDeadInst , "Number of dead inst eliminated");
@@ -4518,6 +4520,12 @@ void InstCombinerImpl::tryToSinkInstructionDPValues(
 }
 
 bool InstCombinerImpl::run() {
+  // Track instructions we have already visited so revisit churn shows up in
+  // statistics output; only maintained when statistics are enabled. Erased
+  // instruction memory may be reused, so this can slightly overcount, which
+  // is fine for a profiling aid.
+  SmallPtrSet<const Instruction *, 32> VisitedInsts;
+
   while (!Worklist.isEmpty()) {
     // Walk deferred instructions in reverse order, and push them to the
     // worklist, which means they'll end up popped from the worklist in-order.
@@ -4548,6 +4556,9 @@ bool InstCombinerImpl::run() {
     if (!DebugCounter::shouldExecute(VisitCounter))
       continue;
 
+    if (AreStatisticsEnabled() && !VisitedInsts.insert(I).second)
+      ++NumRevisits;
+
     // See if we can trivially sink this instruction to its user if we can
     // prove that the successor is not executed more frequently than our block.
     // Return the UserBlock if successful.
@@ -25,8 +25,11 @@
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/GlobalsModRef.h"
 #include "llvm/Analysis/MemoryBuiltins.h"
+#include "llvm/Analysis/OptimizationRemarkEmitter.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Analysis/StackSafetyAnalysis.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/Analysis/ValueTracking.h"
@@ -220,6 +223,15 @@ static cl::opt<bool>
                      cl::Hidden, cl::desc("Use Stack Safety analysis results"),
                      cl::Optional);
 
+static cl::opt<int> ClSkipHotPercentileCutoff(
+    "asan-skip-hot-percentile",
+    cl::desc("Skip the load/store checks in functions whose profile hotness "
+             "is within the given profile summary percentile cutoff "
+             "(e.g. 990000 for the hottest 1%). Stack redzone poisoning and "
+             "noreturn handling are kept so instrumented code still catches "
+             "bugs touching this function's objects. Requires profile data."),
+    cl::Hidden);
+
 static cl::opt<bool> ClInstrumentAtomics(
     "asan-instrument-atomics",
     cl::desc("instrument atomic instructions (rmw, cmpxchg)"), cl::Hidden,
@@ -723,7 +735,8 @@ struct AddressSanitizer {
   void instrumentMemIntrinsic(MemIntrinsic *MI);
   Value *memToShadow(Value *Shadow, IRBuilder<> &IRB);
   bool suppressInstrumentationSiteForDebug(int &Instrumented);
-  bool instrumentFunction(Function &F, const TargetLibraryInfo *TLI);
+  bool instrumentFunction(Function &F, const TargetLibraryInfo *TLI,
+                          bool SkipChecks = false);
   bool maybeInsertAsanInitAtFunctionEntry(Function &F);
   bool maybeInsertDynamicShadowAtFunctionEntry(Function &F);
   void markEscapedLocalAllocas(Function &F);
@@ -1179,15 +1192,36 @@ PreservedAnalyses AddressSanitizerPass::run(Module &M,
       UseGlobalGC, UseOdrIndicator, DestructorKind, ConstructorKind);
   bool Modified = false;
   auto &FAM = MAM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager();
+  ProfileSummaryInfo *PSI = nullptr;
+  if (ClSkipHotPercentileCutoff.getNumOccurrences()) {
+    PSI = &MAM.getResult<ProfileSummaryAnalysis>(M);
+    if (!PSI->hasProfileSummary())
+      PSI = nullptr;
+  }
   const StackSafetyGlobalInfo *const SSGI =
       ClUseStackSafety ? &MAM.getResult<StackSafetyGlobalAnalysis>(M) : nullptr;
   for (Function &F : M) {
+    // If the profile says the function is hot at the requested cutoff, elide
+    // the load/store checks but still run the rest of the instrumentation so
+    // its stack redzones stay consistent with the rest of the program.
+    bool SkipChecks = false;
+    if (PSI && !F.isDeclaration() &&
+        PSI->isFunctionHotInCallGraphNthPercentile(
+            ClSkipHotPercentileCutoff, &F,
+            FAM.getResult<BlockFrequencyAnalysis>(F))) {
+      SkipChecks = true;
+      FAM.getResult<OptimizationRemarkEmitterAnalysis>(F).emit([&]() {
+        return OptimizationRemark(DEBUG_TYPE, "SkipHotFunction", &F)
+               << "eliding address checks in hot function "
+               << ore::NV("Function", &F);
+      });
+    }
     AddressSanitizer FunctionSanitizer(
         M, SSGI, Options.InstrumentationWithCallsThreshold,
         Options.MaxInlinePoisoningSize, Options.CompileKernel, Options.Recover,
         Options.UseAfterScope, Options.UseAfterReturn);
     const TargetLibraryInfo &TLI = FAM.getResult<TargetLibraryAnalysis>(F);
-    Modified |= FunctionSanitizer.instrumentFunction(F, &TLI);
+    Modified |= FunctionSanitizer.instrumentFunction(F, &TLI, SkipChecks);
   }
   Modified |= ModuleSanitizer.instrumentModule(M);
   if (!Modified)
@@ -2850,7 +2884,8 @@ bool AddressSanitizer::suppressInstrumentationSiteForDebug(int &Instrumented) {
 }
 
 bool AddressSanitizer::instrumentFunction(Function &F,
-                                          const TargetLibraryInfo *TLI) {
+                                          const TargetLibraryInfo *TLI,
+                                          bool SkipChecks) {
   if (F.empty())
     return false;
   if (F.getLinkage() == GlobalValue::AvailableExternallyLinkage) return false;
@@ -2946,6 +2981,15 @@ bool AddressSanitizer::instrumentFunction(Function &F,
     }
   }
 
+  if (SkipChecks) {
+    // The profile says this function is hot: drop the load/store checks but
+    // keep the stack poisoning and noreturn handling below so its redzones
+    // stay consistent with the rest of the program.
+    OperandsToInstrument.clear();
+    IntrinToInstrument.clear();
+    PointerComparisonsOrSubtracts.clear();
+  }
+
   bool UseCalls = (InstrumentationWithCallsThreshold >= 0 &&
                    OperandsToInstrument.size() + IntrinToInstrument.size() >
                        (unsigned)InstrumentationWithCallsThreshold);
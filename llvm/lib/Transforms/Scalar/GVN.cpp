@@ -696,6 +696,15 @@ uint32_t GVNPass::ValueTable::lookupOrAddCmp(unsigned Opcode,
   return assignExpNewValueNum(exp).first;
 }
 
+/// Pre-size the value-numbering tables for a function with roughly
+/// \p NumInsts instructions. Most instructions end up with a value number,
+/// so sizing the maps up front replaces a series of rehash-and-copy cycles
+/// with a single allocation.
+void GVNPass::ValueTable::reserve(unsigned NumInsts) {
+  valueNumbering.reserve(NumInsts);
+  expressionNumbering.reserve(NumInsts);
+}
+
 /// Remove all entries from the ValueTable.
 void GVNPass::ValueTable::clear() {
   valueNumbering.clear();
@@ -2706,6 +2715,8 @@ bool GVNPass::runImpl(Function &F, AssumptionCache &RunAC, DominatorTree &RunDT,
   bool Changed = false;
   bool ShouldContinue = true;
 
+  VN.reserve(F.getInstructionCount());
+
   DomTreeUpdater DTU(DT, DomTreeUpdater::UpdateStrategy::Eager);
   // Merge unconditional branches, allowing PRE to catch more
   // optimization opportunities.
@@ -514,9 +514,13 @@ int main(int argc, char **argv) {
     errs() << "Here's the assembly:\n" << *Composite;
 
   std::error_code EC;
+  // Bitcode output goes through a streamable file so the writer can flush
+  // function blocks incrementally instead of holding the whole image in
+  // memory.
   ToolOutputFile Out(OutputFilename, EC,
                      OutputAssembly ? sys::fs::OF_TextWithCRLF
-                                    : sys::fs::OF_None);
+                                    : sys::fs::OF_None,
+                     /*Streamable=*/!OutputAssembly);
   if (EC) {
     WithColor::error() << EC.message() << '\n';
     return 1;
@@ -618,7 +618,10 @@ extern "C" int optMain(
     std::error_code EC;
     sys::fs::OpenFlags Flags =
         OutputAssembly ? sys::fs::OF_TextWithCRLF : sys::fs::OF_None;
-    Out.reset(new ToolOutputFile(OutputFilename, EC, Flags));
+    // Bitcode output goes through a streamable file so the writer can flush
+    // incrementally rather than buffering the whole image.
+    Out.reset(new ToolOutputFile(OutputFilename, EC, Flags,
+                                 /*Streamable=*/!OutputAssembly));
     if (EC) {
       errs() << EC.message() << '\n';
       return 1;
@@ -116,6 +116,41 @@ TEST_F(CoreAPIsStandardTest, ResolveUnrequestedSymbol) {
   EXPECT_TRUE(Result.count(Foo)) << "Expected result for \"Foo\"";
 }
 
+TEST_F(CoreAPIsStandardTest, BatchedBlockingLookup) {
+  // Test that the batched blocking lookup returns one SymbolMap per input
+  // set, in input order.
+  cantFail(JD.define(absoluteSymbols({{Foo, FooSym}, {Bar, BarSym}})));
+
+  std::vector<SymbolLookupSet> Batch;
+  Batch.push_back(SymbolLookupSet(Foo));
+  Batch.push_back(SymbolLookupSet({Foo, Bar}));
+
+  auto Results = cantFail(ES.lookup(makeJITDylibSearchOrder(&JD), Batch));
+  ASSERT_EQ(Results.size(), 2U) << "Unexpected number of batch results";
+  EXPECT_EQ(Results[0].size(), 1U) << "Unexpected number of results for set 0";
+  EXPECT_EQ(Results[0][Foo].getAddress(), FooAddr)
+      << "Lookup returned incorrect result for \"Foo\"";
+  EXPECT_EQ(Results[1].size(), 2U) << "Unexpected number of results for set 1";
+  EXPECT_EQ(Results[1][Foo].getAddress(), FooAddr)
+      << "Lookup returned incorrect result for \"Foo\"";
+  EXPECT_EQ(Results[1][Bar].getAddress(), BarAddr)
+      << "Lookup returned incorrect result for \"Bar\"";
+}
+
+TEST_F(CoreAPIsStandardTest, BatchedBlockingLookupFailure) {
+  // Test that a failing set within a batch turns the whole batched lookup
+  // into an error, and that the error survives the join with the successful
+  // queries.
+  cantFail(JD.define(absoluteSymbols({{Foo, FooSym}})));
+
+  std::vector<SymbolLookupSet> Batch;
+  Batch.push_back(SymbolLookupSet(Foo));
+  Batch.push_back(SymbolLookupSet(Baz)); // Baz is not defined.
+
+  auto Results = ES.lookup(makeJITDylibSearchOrder(&JD), Batch);
+  EXPECT_THAT_EXPECTED(std::move(Results), Failed<SymbolsNotFound>());
+}
+
 TEST_F(CoreAPIsStandardTest, MaterializationSideEffctsOnlyBasic) {
   // Test that basic materialization-side-effects-only symbols work as expected:
   // that they can be emitted without being resolved, that queries for them
@@ -61,4 +61,41 @@ TEST(TimeProfiler, Begin_End_Disabled) {
   timeTraceProfilerEnd();
 }
 
+TEST(TimeProfiler, Instant_Event_Smoke) {
+  setupProfiler();
+
+  timeTraceProfilerBegin("event", "detail");
+  timeTraceAddInstantEvent("instant", [] { return "instant detail"; });
+  timeTraceProfilerEnd();
+
+  std::string json = teardownProfiler();
+  ASSERT_TRUE(json.find(R"("ph":"i")") != std::string::npos);
+  ASSERT_TRUE(json.find(R"("name":"instant")") != std::string::npos);
+  ASSERT_TRUE(json.find(R"("detail":"instant detail")") != std::string::npos);
+}
+
+TEST(TimeProfiler, Instant_Event_Disabled) {
+  // As with Begin_End_Disabled, just checking for a stray nullptr deref.
+  timeTraceAddInstantEvent("instant", [] { return "instant detail"; });
+}
+
+TEST(TimeProfiler, Memory_Counters) {
+  timeTraceProfilerInitialize(/*TimeTraceGranularity=*/0, "test",
+                              /*TimeTraceMemory=*/true);
+
+  { TimeTraceScope scope("event", "detail"); }
+
+  std::string json = teardownProfiler();
+  ASSERT_TRUE(json.find(R"("malloc delta":)") != std::string::npos);
+}
+
+TEST(TimeProfiler, Memory_Counters_Disabled) {
+  setupProfiler();
+
+  { TimeTraceScope scope("event", "detail"); }
+
+  std::string json = teardownProfiler();
+  ASSERT_TRUE(json.find(R"("malloc delta")") == std::string::npos);
+}
+
 } // namespace
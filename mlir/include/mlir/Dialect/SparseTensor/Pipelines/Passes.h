@@ -75,6 +75,12 @@ struct SparsifierOptions : public PassPipelineOptions<SparsifierOptions> {
            "This option is only used when enable-runtime-library=false."),
       init(true)};
 
+  PassOptions::Option<bool> enableOpenMP{
+      *this, "enable-openmp",
+      desc("Lower the parallel loops emitted by the parallelization strategy "
+           "to OpenMP constructs"),
+      init(false)};
+
   PassOptions::Option<int32_t> vectorLength{
       *this, "vl", desc("Set the vector length (0 disables vectorization)"),
       init(0)};
@@ -762,6 +762,12 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
     Operation *op;
     /// The analysis manager for the operation.
     AnalysisManager am;
+    /// The position of `op` within the parent operation, used to order
+    /// diagnostics independently of the scheduling order below.
+    unsigned irOrderIdx = 0;
+    /// The number of operations nested under `op`, used as a proxy for how
+    /// expensive running the pipeline over `op` will be.
+    uint64_t numNestedOps = 0;
   };
 
   // Run a prepass over the operation to collect the nested operations to
@@ -779,11 +785,26 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
       }
 
       // If this operation can be scheduled, add it to the list.
-      if (pmIdxIt.first->second)
+      if (pmIdxIt.first->second) {
         opInfos.emplace_back(*pmIdxIt.first->second, &op, am.nest(&op));
+        opInfos.back().irOrderIdx = opInfos.size() - 1;
+      }
     }
   }
 
+  // The executors below pull operations off the queue in order, so schedule
+  // the largest operations first to approximate longest-processing-time-first
+  // scheduling. Without this, a large operation scheduled late runs alone as
+  // the tail of the parallel run while the other executors sit idle. The sort
+  // is stable so equally-sized operations keep their original order.
+  if (opInfos.size() > 1) {
+    for (OpPMInfo &opInfo : opInfos)
+      opInfo.op->walk([&](Operation *) { ++opInfo.numNestedOps; });
+    llvm::stable_sort(opInfos, [](const OpPMInfo &lhs, const OpPMInfo &rhs) {
+      return lhs.numNestedOps > rhs.numNestedOps;
+    });
+  }
+
   // Get the current thread for this adaptor.
   PassInstrumentation::PipelineParentInfo parentInfo = {llvm::get_threadid(),
                                                         this};
@@ -811,8 +832,44 @@ void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
     return pipelineResult;
   };
 
+  // Dispatch the operations to the executors. This mirrors
+  // failableParallelForEach, except that the parallel diagnostic handler is
+  // driven by each operation's position within the IR rather than its position
+  // within the size-sorted queue, so diagnostics are still emitted in IR
+  // order.
+  if (opInfos.size() <= 1) {
+    if (!opInfos.empty() && failed(processFn(opInfos.front())))
+      signalPassFailure();
+    return;
+  }
+  ParallelDiagnosticHandler diagHandler(context);
+  std::atomic<unsigned> curIndex(0);
+  std::atomic<bool> processingFailed(false);
+  auto dispatchFn = [&] {
+    while (!processingFailed) {
+      unsigned index = curIndex++;
+      if (index >= opInfos.size())
+        break;
+      OpPMInfo &opInfo = opInfos[index];
+      diagHandler.setOrderIDForThread(opInfo.irOrderIdx);
+      if (failed(processFn(opInfo)))
+        processingFailed = true;
+      diagHandler.eraseOrderIDForThread();
+    }
+  };
+  llvm::ThreadPool &threadPool = context->getThreadPool();
+  llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
+  size_t numActions =
+      std::min<size_t>(opInfos.size(), threadPool.getThreadCount());
+  for (size_t i = 0; i < numActions; ++i)
+    tasksGroup.async(dispatchFn);
+  // If the current thread is a worker thread from the pool, then waiting for
+  // the task group allows the current thread to also participate in processing
+  // tasks from the group, which avoids any deadlock/starvation.
+  tasksGroup.wait();
+
   // Signal a failure if any of the executors failed.
-  if (failed(failableParallelForEach(context, opInfos, processFn)))
+  if (processingFailed)
     signalPassFailure();
 }
 